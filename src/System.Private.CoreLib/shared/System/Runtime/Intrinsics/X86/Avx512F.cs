@@ -0,0 +1,260 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System.Runtime.CompilerServices;
+
+namespace System.Runtime.Intrinsics.X86
+{
+    /// <summary>
+    /// This class provides access to Intel AVX-512F hardware instructions via intrinsics.
+    /// Only the 128-bit and 256-bit forms (AVX-512VL) are exposed.
+    /// </summary>
+    [Intrinsic]
+    [CLSCompliant(false)]
+    public abstract class Avx512F : Avx2
+    {
+        internal Avx512F() { }
+
+        public static new bool IsSupported { get => IsSupported; }
+
+        /// <summary>
+        /// __m128i _mm_abs_epi64 (__m128i a)
+        ///   VPABSQ xmm, xmm/m128
+        /// </summary>
+        public static Vector128<ulong> Abs(Vector128<long> value) => Abs(value);
+        /// <summary>
+        /// __m256i _mm256_abs_epi64 (__m256i a)
+        ///   VPABSQ ymm, ymm/m256
+        /// </summary>
+        public static Vector256<ulong> Abs(Vector256<long> value) => Abs(value);
+
+        /// <summary>
+        /// __m128i _mm_max_epi64 (__m128i a, __m128i b)
+        ///   VPMAXSQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<long> Max(Vector128<long> left, Vector128<long> right) => Max(left, right);
+        /// <summary>
+        /// __m128i _mm_max_epu64 (__m128i a, __m128i b)
+        ///   VPMAXUQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<ulong> Max(Vector128<ulong> left, Vector128<ulong> right) => Max(left, right);
+        /// <summary>
+        /// __m256i _mm256_max_epi64 (__m256i a, __m256i b)
+        ///   VPMAXSQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<long> Max(Vector256<long> left, Vector256<long> right) => Max(left, right);
+        /// <summary>
+        /// __m256i _mm256_max_epu64 (__m256i a, __m256i b)
+        ///   VPMAXUQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<ulong> Max(Vector256<ulong> left, Vector256<ulong> right) => Max(left, right);
+
+        /// <summary>
+        /// __m128i _mm_min_epi64 (__m128i a, __m128i b)
+        ///   VPMINSQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<long> Min(Vector128<long> left, Vector128<long> right) => Min(left, right);
+        /// <summary>
+        /// __m128i _mm_min_epu64 (__m128i a, __m128i b)
+        ///   VPMINUQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<ulong> Min(Vector128<ulong> left, Vector128<ulong> right) => Min(left, right);
+        /// <summary>
+        /// __m256i _mm256_min_epi64 (__m256i a, __m256i b)
+        ///   VPMINSQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<long> Min(Vector256<long> left, Vector256<long> right) => Min(left, right);
+        /// <summary>
+        /// __m256i _mm256_min_epu64 (__m256i a, __m256i b)
+        ///   VPMINUQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<ulong> Min(Vector256<ulong> left, Vector256<ulong> right) => Min(left, right);
+
+        /// <summary>
+        /// __m128i _mm_rol_epi32 (__m128i a, int imm8)
+        ///   VPROLD xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<int> RotateLeft(Vector128<int> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m128i _mm_rol_epi32 (__m128i a, int imm8)
+        ///   VPROLD xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<uint> RotateLeft(Vector128<uint> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m128i _mm_rol_epi64 (__m128i a, int imm8)
+        ///   VPROLQ xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<long> RotateLeft(Vector128<long> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m128i _mm_rol_epi64 (__m128i a, int imm8)
+        ///   VPROLQ xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<ulong> RotateLeft(Vector128<ulong> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m256i _mm256_rol_epi32 (__m256i a, int imm8)
+        ///   VPROLD ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<int> RotateLeft(Vector256<int> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m256i _mm256_rol_epi32 (__m256i a, int imm8)
+        ///   VPROLD ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<uint> RotateLeft(Vector256<uint> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m256i _mm256_rol_epi64 (__m256i a, int imm8)
+        ///   VPROLQ ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<long> RotateLeft(Vector256<long> value, byte count) => RotateLeft(value, count);
+        /// <summary>
+        /// __m256i _mm256_rol_epi64 (__m256i a, int imm8)
+        ///   VPROLQ ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<ulong> RotateLeft(Vector256<ulong> value, byte count) => RotateLeft(value, count);
+
+        /// <summary>
+        /// __m128i _mm_rolv_epi32 (__m128i a, __m128i b)
+        ///   VPROLVD xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<int> RotateLeftVariable(Vector128<int> value, Vector128<uint> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rolv_epi32 (__m128i a, __m128i b)
+        ///   VPROLVD xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<uint> RotateLeftVariable(Vector128<uint> value, Vector128<uint> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rolv_epi64 (__m128i a, __m128i b)
+        ///   VPROLVQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<long> RotateLeftVariable(Vector128<long> value, Vector128<ulong> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rolv_epi64 (__m128i a, __m128i b)
+        ///   VPROLVQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<ulong> RotateLeftVariable(Vector128<ulong> value, Vector128<ulong> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rolv_epi32 (__m256i a, __m256i b)
+        ///   VPROLVD ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<int> RotateLeftVariable(Vector256<int> value, Vector256<uint> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rolv_epi32 (__m256i a, __m256i b)
+        ///   VPROLVD ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<uint> RotateLeftVariable(Vector256<uint> value, Vector256<uint> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rolv_epi64 (__m256i a, __m256i b)
+        ///   VPROLVQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<long> RotateLeftVariable(Vector256<long> value, Vector256<ulong> count) => RotateLeftVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rolv_epi64 (__m256i a, __m256i b)
+        ///   VPROLVQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<ulong> RotateLeftVariable(Vector256<ulong> value, Vector256<ulong> count) => RotateLeftVariable(value, count);
+
+        /// <summary>
+        /// __m128i _mm_ror_epi32 (__m128i a, int imm8)
+        ///   VPRORD xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<int> RotateRight(Vector128<int> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m128i _mm_ror_epi32 (__m128i a, int imm8)
+        ///   VPRORD xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<uint> RotateRight(Vector128<uint> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m128i _mm_ror_epi64 (__m128i a, int imm8)
+        ///   VPRORQ xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<long> RotateRight(Vector128<long> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m128i _mm_ror_epi64 (__m128i a, int imm8)
+        ///   VPRORQ xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<ulong> RotateRight(Vector128<ulong> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m256i _mm256_ror_epi32 (__m256i a, int imm8)
+        ///   VPRORD ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<int> RotateRight(Vector256<int> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m256i _mm256_ror_epi32 (__m256i a, int imm8)
+        ///   VPRORD ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<uint> RotateRight(Vector256<uint> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m256i _mm256_ror_epi64 (__m256i a, int imm8)
+        ///   VPRORQ ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<long> RotateRight(Vector256<long> value, byte count) => RotateRight(value, count);
+        /// <summary>
+        /// __m256i _mm256_ror_epi64 (__m256i a, int imm8)
+        ///   VPRORQ ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<ulong> RotateRight(Vector256<ulong> value, byte count) => RotateRight(value, count);
+
+        /// <summary>
+        /// __m128i _mm_rorv_epi32 (__m128i a, __m128i b)
+        ///   VPRORVD xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<int> RotateRightVariable(Vector128<int> value, Vector128<uint> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rorv_epi32 (__m128i a, __m128i b)
+        ///   VPRORVD xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<uint> RotateRightVariable(Vector128<uint> value, Vector128<uint> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rorv_epi64 (__m128i a, __m128i b)
+        ///   VPRORVQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<long> RotateRightVariable(Vector128<long> value, Vector128<ulong> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m128i _mm_rorv_epi64 (__m128i a, __m128i b)
+        ///   VPRORVQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<ulong> RotateRightVariable(Vector128<ulong> value, Vector128<ulong> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rorv_epi32 (__m256i a, __m256i b)
+        ///   VPRORVD ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<int> RotateRightVariable(Vector256<int> value, Vector256<uint> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rorv_epi32 (__m256i a, __m256i b)
+        ///   VPRORVD ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<uint> RotateRightVariable(Vector256<uint> value, Vector256<uint> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rorv_epi64 (__m256i a, __m256i b)
+        ///   VPRORVQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<long> RotateRightVariable(Vector256<long> value, Vector256<ulong> count) => RotateRightVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_rorv_epi64 (__m256i a, __m256i b)
+        ///   VPRORVQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<ulong> RotateRightVariable(Vector256<ulong> value, Vector256<ulong> count) => RotateRightVariable(value, count);
+
+        /// <summary>
+        /// __m128i _mm_srai_epi64 (__m128i a, int imm8)
+        ///   VPSRAQ xmm, xmm/m128, imm8
+        /// </summary>
+        public static Vector128<long> ShiftRightArithmetic(Vector128<long> value, byte count) => ShiftRightArithmetic(value, count);
+        /// <summary>
+        /// __m256i _mm256_srai_epi64 (__m256i a, int imm8)
+        ///   VPSRAQ ymm, ymm/m256, imm8
+        /// </summary>
+        public static Vector256<long> ShiftRightArithmetic(Vector256<long> value, byte count) => ShiftRightArithmetic(value, count);
+
+        /// <summary>
+        /// __m128i _mm_srav_epi64 (__m128i a, __m128i count)
+        ///   VPSRAVQ xmm, xmm, xmm/m128
+        /// </summary>
+        public static Vector128<long> ShiftRightArithmeticVariable(Vector128<long> value, Vector128<ulong> count) => ShiftRightArithmeticVariable(value, count);
+        /// <summary>
+        /// __m256i _mm256_srav_epi64 (__m256i a, __m256i count)
+        ///   VPSRAVQ ymm, ymm, ymm/m256
+        /// </summary>
+        public static Vector256<long> ShiftRightArithmeticVariable(Vector256<long> value, Vector256<ulong> count) => ShiftRightArithmeticVariable(value, count);
+    }
+}
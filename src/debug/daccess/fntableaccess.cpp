@@ -140,6 +140,21 @@ static NTSTATUS OutOfProcessFindHeader(ReadMemoryFunction fpReadMemory,PVOID pUs
         pHeader = tmp;                                      \
     }
 
+// The cold section of a split method has a code header of its own that shares the real code
+// header with the hot section, whose entry already covers all of the unwind infos of the method.
+static bool IsColdCodeHeader(ReadMemoryFunction fpReadMemory, PVOID pUserContext, DWORD_PTR pRealHeader, DWORD_PTR pHeader)
+{
+#ifdef _TARGET_AMD64_
+    DWORD_PTR coldCodeStart;
+    if (!fpReadMemory(pUserContext, (LPCVOID)(pRealHeader + offsetof(CODE_HEADER, phdrColdCodeStart)), &coldCodeStart, sizeof(coldCodeStart), NULL))
+        return false;
+
+    return coldCodeStart == pHeader + sizeof(FakeCodeHeader);
+#else
+    return false;
+#endif
+}
+
 static NTSTATUS OutOfProcessFunctionTableCallback_JIT(IN  ReadMemoryFunction    fpReadMemory,
                                                       IN  PVOID                 pUserContext,
                                                       IN  PVOID                 TableAddress,
@@ -205,7 +220,7 @@ static NTSTATUS OutOfProcessFunctionTableCallback_JIT(IN  ReadMemoryFunction
                 pThisHeader = Hp.mapBase + hdrOffset;
                 ResolveCodeHeader(pThisHeader);
 
-                if (pThisHeader > FAKE_STUB_CODE_BLOCK_LAST)
+                if ((pThisHeader > FAKE_STUB_CODE_BLOCK_LAST) && !IsColdCodeHeader(fpReadMemory, pUserContext, pThisHeader, Hp.mapBase + hdrOffset))
                 {
                     DWORD nUnwindInfos;
                     move_field(nUnwindInfos, pThisHeader, CODE_HEADER, nUnwindInfos);
@@ -236,7 +251,7 @@ static NTSTATUS OutOfProcessFunctionTableCallback_JIT(IN  ReadMemoryFunction
                 pThisHeader = Hp.mapBase + hdrOffset;
                 ResolveCodeHeader(pThisHeader);
 
-                if (pThisHeader > FAKE_STUB_CODE_BLOCK_LAST)
+                if ((pThisHeader > FAKE_STUB_CODE_BLOCK_LAST) && !IsColdCodeHeader(fpReadMemory, pUserContext, pThisHeader, Hp.mapBase + hdrOffset))
                 {
                     DWORD nUnwindInfos;
                     move_field(nUnwindInfos, pThisHeader, CODE_HEADER, nUnwindInfos);
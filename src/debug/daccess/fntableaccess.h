@@ -53,6 +53,10 @@ typedef struct _FakeHpRealCodeHdr
     LPVOID              pCalledMethods;
 #endif
     LPVOID              hdrMDesc;       // changed from MethodDesc*
+#ifdef _TARGET_AMD64_
+    DWORD_PTR           phdrColdCodeStart; // changed from TADDR
+    DWORD               phdrHotCodeSize;
+#endif
     DWORD               nUnwindInfos;
     T_RUNTIME_FUNCTION  unwindInfos[0];
 } FakeRealCodeHeader;
@@ -144,6 +148,9 @@ class CheckDuplicatedStructLayouts
     CHECK_OFFSET(HeapList, pHdrMap);
 
 #if !defined(_TARGET_X86_)
+#ifdef _TARGET_AMD64_
+    CHECK_OFFSET(RealCodeHeader,    phdrColdCodeStart);
+#endif
     CHECK_OFFSET(RealCodeHeader,    nUnwindInfos);
     CHECK_OFFSET(RealCodeHeader,    unwindInfos);
 #endif  // !_TARGET_X86_
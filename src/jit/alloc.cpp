@@ -263,6 +263,7 @@ void ArenaAllocator::MemStats::Print(FILE* f)
 {
     fprintf(f, "count: %10u, size: %10llu, max = %10llu\n", allocCnt, allocSz, allocSzMax);
     fprintf(f, "allocateMemory: %10llu, nraUsed: %10llu\n", nraTotalSizeAlloc, nraTotalSizeUsed);
+    fprintf(f, "pages: %10u\n", nraPageCount);
     PrintByKind(f);
 }
 
@@ -292,9 +293,34 @@ void ArenaAllocator::AggregateMemStats::Print(FILE* f)
     fprintf(f, "\n");
     fprintf(f, "  allocateMemory   : %12llu (avg %7llu per method)\n", nraTotalSizeAlloc, nraTotalSizeAlloc / nMethods);
     fprintf(f, "  nraUsed    : %12llu (avg %7llu per method)\n", nraTotalSizeUsed, nraTotalSizeUsed / nMethods);
+    fprintf(f, "  pages      : %12u (avg %7u per method, max %u)\n", nraPageCount, nraPageCount / nMethods,
+            nraPageCountMax);
     PrintByKind(f);
 }
 
+//------------------------------------------------------------------------
+// ArenaAllocator::getPageCount:
+//    Gets the number of arena pages requested from the host for an
+//    `ArenaAllocator`.
+//
+// Return Value:
+//    See above.
+//
+// Notes:
+//    This is the number of slabs the host has to keep warm to satisfy
+//    the allocator without going to the OS; the aggregate stats report it
+//    to help size the host's slab caches.
+unsigned ArenaAllocator::getPageCount()
+{
+    unsigned count = 0;
+    for (PageDescriptor* page = m_firstPage; page != nullptr; page = page->m_next)
+    {
+        count++;
+    }
+
+    return count;
+}
+
 ArenaAllocator::MemStatsAllocator* ArenaAllocator::getMemStatsAllocator(CompMemKind kind)
 {
     assert(kind < CMK_Count);
@@ -312,6 +338,7 @@ void ArenaAllocator::finishMemStats()
 {
     m_stats.nraTotalSizeAlloc = getTotalBytesAllocated();
     m_stats.nraTotalSizeUsed  = getTotalBytesUsed();
+    m_stats.nraPageCount      = getPageCount();
 
     CritSecHolder statsLock(s_statsLock);
     s_aggStats.Add(m_stats);
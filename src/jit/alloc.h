@@ -64,6 +64,7 @@ private:
         UINT64   allocSzByKind[CMK_Count]; // Classified by "kind".
         UINT64   nraTotalSizeAlloc;
         UINT64   nraTotalSizeUsed;
+        unsigned nraPageCount; // # of arena pages requested from the host
 
         static const char* s_CompMemKindNames[]; // Names of the kinds.
 
@@ -85,6 +86,7 @@ private:
     struct AggregateMemStats : public MemStats
     {
         unsigned nMethods;
+        unsigned nraPageCountMax; // Maximum # of arena pages used by a single method.
 
         void Add(const MemStats& ms)
         {
@@ -98,6 +100,8 @@ private:
             }
             nraTotalSizeAlloc += ms.nraTotalSizeAlloc;
             nraTotalSizeUsed += ms.nraTotalSizeUsed;
+            nraPageCount += ms.nraPageCount;
+            nraPageCountMax = max(nraPageCountMax, ms.nraPageCount);
         }
 
         void Print(FILE* f); // Print these stats to file.
@@ -126,6 +130,7 @@ private:
 
 public:
     MemStatsAllocator* getMemStatsAllocator(CompMemKind kind);
+    unsigned getPageCount();
     void finishMemStats();
     void dumpMemStats(FILE* file);
 
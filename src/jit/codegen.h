@@ -1106,6 +1106,9 @@ protected:
     void genCodeForReturnTrap(GenTreeOp* tree);
     void genCodeForJcc(GenTreeCC* tree);
     void genCodeForSetcc(GenTreeCC* setcc);
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    void genCodeForSelectCC(GenTreeOpCC* select);
+#endif // _TARGET_XARCH_ || _TARGET_ARM64_
     void genCodeForStoreInd(GenTreeStoreInd* tree);
     void genCodeForSwap(GenTreeOp* tree);
     void genCodeForCpObj(GenTreeObj* cpObjNode);
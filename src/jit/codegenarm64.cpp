@@ -2797,14 +2797,14 @@ void CodeGen::genJumpTable(GenTree* treeNode)
 
     jmpTabOffs = 0;
 
-    JITDUMP("\n      J_M%03u_DS%02u LABEL   DWORD\n", Compiler::s_compMethodsCount, jmpTabBase);
+    JITDUMP("\n      J_M%03u_DS%02u LABEL   DWORD\n", compiler->compMethodID, jmpTabBase);
 
     for (unsigned i = 0; i < jumpCount; i++)
     {
         BasicBlock* target = *jumpTable++;
         noway_assert(target->bbFlags & BBF_JMP_TARGET);
 
-        JITDUMP("            DD      L_M%03u_" FMT_BB "\n", Compiler::s_compMethodsCount, target->bbNum);
+        JITDUMP("            DD      L_M%03u_" FMT_BB "\n", compiler->compMethodID, target->bbNum);
 
         GetEmitter()->emitDataGenData(i, target);
     };
@@ -3616,6 +3616,34 @@ void CodeGen::genCodeForCompare(GenTreeOp* tree)
     }
 }
 
+//------------------------------------------------------------------------
+// genCodeForSelectCC: Generate code for a GT_SELECTCC node.
+//
+// Arguments:
+//    select - The node
+//
+// Notes:
+//    The condition flags were set by the node preceding the select.
+//
+void CodeGen::genCodeForSelectCC(GenTreeOpCC* select)
+{
+    assert(select->OperIs(GT_SELECTCC));
+
+    genConsumeOperands(select);
+
+    const GenConditionDesc& desc = GenConditionDesc::Get(select->gtCondition);
+    assert(desc.oper == GT_NONE);
+
+    // The insCond values are laid out in the same order as the jump kinds.
+    static_assert_no_msg(INS_COND_LE - INS_COND_EQ == EJ_le - EJ_eq);
+    insCond cond = static_cast<insCond>(INS_COND_EQ + (desc.jumpKind1 - EJ_eq));
+
+    GetEmitter()->emitIns_R_R_R_COND(INS_csel, emitActualTypeSize(select->TypeGet()), select->gtRegNum,
+                                     select->gtGetOp1()->gtRegNum, select->gtGetOp2()->gtRegNum, cond);
+
+    genProduceReg(select);
+}
+
 //------------------------------------------------------------------------
 // genCodeForJumpCompare: Generates code for jmpCompare statement.
 //
@@ -391,6 +391,12 @@ void CodeGen::genCodeForTreeNode(GenTree* treeNode)
             genCodeForSetcc(treeNode->AsCC());
             break;
 
+#ifdef _TARGET_ARM64_
+        case GT_SELECTCC:
+            genCodeForSelectCC(treeNode->AsOpCC());
+            break;
+#endif // _TARGET_ARM64_
+
         case GT_RETURNTRAP:
             genCodeForReturnTrap(treeNode->AsOp());
             break;
@@ -1523,6 +1523,57 @@ void CodeGen::inst_SETCC(GenCondition condition, var_types type, regNumber dstRe
     }
 }
 
+//------------------------------------------------------------------------
+// genCodeForSelectCC: Generate code for a GT_SELECTCC node.
+//
+// Arguments:
+//    select - The node
+//
+// Notes:
+//    The condition flags were set by the node preceding the select, and
+//    neither mov nor cmov modify them.
+//
+void CodeGen::genCodeForSelectCC(GenTreeOpCC* select)
+{
+    assert(select->OperIs(GT_SELECTCC));
+
+    var_types targetType = select->TypeGet();
+    regNumber targetReg  = select->gtRegNum;
+    emitAttr  attr       = emitActualTypeSize(targetType);
+
+    genConsumeOperands(select);
+
+    regNumber trueReg  = select->gtGetOp1()->gtRegNum;
+    regNumber falseReg = select->gtGetOp2()->gtRegNum;
+
+    const GenConditionDesc& desc = GenConditionDesc::Get(select->gtCondition);
+    assert(desc.oper == GT_NONE);
+
+    emitJumpKind jumpKind = desc.jumpKind1;
+    regNumber    srcReg   = trueReg;
+
+    if (targetReg == trueReg)
+    {
+        // The target already holds the "true" value, conditionally move the "false" value instead.
+        jumpKind = emitter::emitReverseJumpKind(jumpKind);
+        srcReg   = falseReg;
+    }
+    else if (targetReg != falseReg)
+    {
+        GetEmitter()->emitIns_R_R(INS_mov, attr, targetReg, falseReg);
+    }
+
+    if (srcReg != targetReg)
+    {
+        // The cmovcc instructions are laid out in the same order as the jcc jump kinds.
+        static_assert_no_msg(INS_cmovg - INS_cmovo == EJ_jg - EJ_jo);
+        instruction ins = static_cast<instruction>(INS_cmovo + (jumpKind - EJ_jo));
+        GetEmitter()->emitIns_R_R(ins, attr, targetReg, srcReg);
+    }
+
+    genProduceReg(select);
+}
+
 //------------------------------------------------------------------------
 // genCodeForReturnTrap: Produce code for a GT_RETURNTRAP node.
 //
@@ -1847,6 +1898,10 @@ void CodeGen::genCodeForTreeNode(GenTree* treeNode)
             genCodeForSetcc(treeNode->AsCC());
             break;
 
+        case GT_SELECTCC:
+            genCodeForSelectCC(treeNode->AsOpCC());
+            break;
+
         case GT_BT:
             genCodeForBT(treeNode->AsOp());
             break;
@@ -3841,14 +3896,14 @@ void CodeGen::genJumpTable(GenTree* treeNode)
 
     jmpTabOffs = 0;
 
-    JITDUMP("\n      J_M%03u_DS%02u LABEL   DWORD\n", Compiler::s_compMethodsCount, jmpTabBase);
+    JITDUMP("\n      J_M%03u_DS%02u LABEL   DWORD\n", compiler->compMethodID, jmpTabBase);
 
     for (unsigned i = 0; i < jumpCount; i++)
     {
         BasicBlock* target = *jumpTable++;
         noway_assert(target->bbFlags & BBF_JMP_TARGET);
 
-        JITDUMP("            DD      L_M%03u_" FMT_BB "\n", Compiler::s_compMethodsCount, target->bbNum);
+        JITDUMP("            DD      L_M%03u_" FMT_BB "\n", compiler->compMethodID, target->bbNum);
 
         GetEmitter()->emitDataGenData(i, target);
     };
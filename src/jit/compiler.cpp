@@ -41,18 +41,15 @@ LONG Compiler::jitNestingLevel = 0;
 
 #ifdef ALT_JIT
 // static
-bool                Compiler::s_pAltJitExcludeAssembliesListInitialized = false;
-AssemblyNamesList2* Compiler::s_pAltJitExcludeAssembliesList            = nullptr;
+AssemblyNamesList2* Compiler::s_pAltJitExcludeAssembliesList = nullptr;
 #endif // ALT_JIT
 
 #ifdef DEBUG
 // static
-bool                Compiler::s_pJitDisasmIncludeAssembliesListInitialized = false;
-AssemblyNamesList2* Compiler::s_pJitDisasmIncludeAssembliesList            = nullptr;
+AssemblyNamesList2* Compiler::s_pJitDisasmIncludeAssembliesList = nullptr;
 
 // static
-bool       Compiler::s_pJitFunctionFileInitialized = false;
-MethodSet* Compiler::s_pJitMethodSet               = nullptr;
+MethodSet* Compiler::s_pJitMethodSet = nullptr;
 #endif // DEBUG
 
 /*****************************************************************************
@@ -1299,7 +1296,7 @@ size_t genFlowNodeCnt;
 
 #ifdef DEBUG
 /* static */
-unsigned Compiler::s_compMethodsCount = 0; // to produce unique label names
+LONG Compiler::s_compMethodsCount = 0; // to produce unique method numbers
 #endif
 
 #if MEASURE_MEM_ALLOC
@@ -1340,9 +1337,53 @@ void Compiler::compStartup()
     // Static vars of ValueNumStore
     ValueNumStore::InitValueNumStoreStatics();
 
+    compInitConfigLists();
+
     compDisplayStaticSizes(jitstdout);
 }
 
+//------------------------------------------------------------------------
+// compInitConfigLists: Read the assembly and method lists specified by the
+//    JIT configuration.
+//
+// Notes:
+//    These lists used to be read lazily by the first compilation that needed
+//    them. Methods may be compiled concurrently by many threads so reading them
+//    once, at startup, avoids racing on the initialization and keeps the
+//    per-method path free of shared mutable state.
+//
+//    The lists are allocated in the process heap, not in the per-compilation
+//    arena, since they live until the JIT is shut down.
+//
+/* static */
+void Compiler::compInitConfigLists()
+{
+#ifdef ALT_JIT
+    const WCHAR* wszAltJitExcludeAssemblyList = JitConfig.AltJitExcludeAssemblies();
+    if (wszAltJitExcludeAssemblyList != nullptr)
+    {
+        s_pAltJitExcludeAssembliesList = new (HostAllocator::getHostAllocator())
+            AssemblyNamesList2(wszAltJitExcludeAssemblyList, HostAllocator::getHostAllocator());
+    }
+#endif // ALT_JIT
+
+#ifdef DEBUG
+    const WCHAR* assemblyNameList = JitConfig.JitDisasmAssemblies();
+    if (assemblyNameList != nullptr)
+    {
+        s_pJitDisasmIncludeAssembliesList = new (HostAllocator::getHostAllocator())
+            AssemblyNamesList2(assemblyNameList, HostAllocator::getHostAllocator());
+    }
+
+    const WCHAR* functionFileName = JitConfig.JitFunctionFile();
+    if (functionFileName != nullptr)
+    {
+        s_pJitMethodSet =
+            new (HostAllocator::getHostAllocator()) MethodSet(functionFileName, HostAllocator::getHostAllocator());
+    }
+#endif // DEBUG
+}
+
 /*****************************************************************************
  *
  *  One time finalization code
@@ -2267,6 +2308,13 @@ void Compiler::compSetProcessor()
                                 if (jitFlags.IsSet(JitFlags::JIT_FLAG_USE_AVX2) && JitConfig.EnableAVX2())
                                 {
                                     opts.setSupportedISA(InstructionSet_AVX2);
+
+                                    // The VM only sets JIT_FLAG_USE_AVX_512 when both AVX512F and AVX512VL
+                                    // are available, as we only emit the 128-bit and 256-bit EVEX forms.
+                                    if (jitFlags.IsSet(JitFlags::JIT_FLAG_USE_AVX_512) && JitConfig.EnableAVX512F())
+                                    {
+                                        opts.setSupportedISA(InstructionSet_AVX512F);
+                                    }
                                 }
                             }
                         }
@@ -2573,21 +2621,7 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     // Take care of COMPlus_AltJitExcludeAssemblies.
     if (opts.altJit)
     {
-        // First, initialize the AltJitExcludeAssemblies list, but only do it once.
-        if (!s_pAltJitExcludeAssembliesListInitialized)
-        {
-            const WCHAR* wszAltJitExcludeAssemblyList = JitConfig.AltJitExcludeAssemblies();
-            if (wszAltJitExcludeAssemblyList != nullptr)
-            {
-                // NOTE: The Assembly name list is allocated in the process heap, not in the no-release heap, which is
-                // reclaimed
-                // for every compilation. This is ok because we only allocate once, due to the static.
-                s_pAltJitExcludeAssembliesList = new (HostAllocator::getHostAllocator())
-                    AssemblyNamesList2(wszAltJitExcludeAssemblyList, HostAllocator::getHostAllocator());
-            }
-            s_pAltJitExcludeAssembliesListInitialized = true;
-        }
-
+        // The AltJitExcludeAssemblies list is read once, by compInitConfigLists.
         if (s_pAltJitExcludeAssembliesList != nullptr)
         {
             // We have an exclusion list. See if this method is in an assembly that is on the list.
@@ -3116,18 +3150,6 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
         {
             bool disEnabled = true;
 
-            // Setup assembly name list for disassembly, if not already set up.
-            if (!s_pJitDisasmIncludeAssembliesListInitialized)
-            {
-                const WCHAR* assemblyNameList = JitConfig.JitDisasmAssemblies();
-                if (assemblyNameList != nullptr)
-                {
-                    s_pJitDisasmIncludeAssembliesList = new (HostAllocator::getHostAllocator())
-                        AssemblyNamesList2(assemblyNameList, HostAllocator::getHostAllocator());
-                }
-                s_pJitDisasmIncludeAssembliesListInitialized = true;
-            }
-
             // If we have an assembly name list for disassembly, also check this method's assembly.
             if (s_pJitDisasmIncludeAssembliesList != nullptr && !s_pJitDisasmIncludeAssembliesList->IsEmpty())
             {
@@ -3257,18 +3279,6 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
 
     memset(compActiveStressModes, 0, sizeof(compActiveStressModes));
 
-    // Read function list, if not already read, and there exists such a list.
-    if (!s_pJitFunctionFileInitialized)
-    {
-        const WCHAR* functionFileName = JitConfig.JitFunctionFile();
-        if (functionFileName != nullptr)
-        {
-            s_pJitMethodSet =
-                new (HostAllocator::getHostAllocator()) MethodSet(functionFileName, HostAllocator::getHostAllocator());
-        }
-        s_pJitFunctionFileInitialized = true;
-    }
-
 #endif // DEBUG
 
 //-------------------------------------------------------------------------
@@ -4579,6 +4589,7 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         bool doCopyProp      = true;
         bool doAssertionProp = true;
         bool doRangeAnalysis = true;
+        bool doBranchOpt     = true;
         int  iterations      = 1;
 
 #if defined(OPT_CONFIG)
@@ -4589,6 +4600,7 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         doCopyProp      = doValueNum && (JitConfig.JitDoCopyProp() != 0);
         doAssertionProp = doValueNum && (JitConfig.JitDoAssertionProp() != 0);
         doRangeAnalysis = doAssertionProp && (JitConfig.JitDoRangeAnalysis() != 0);
+        doBranchOpt     = doValueNum && (JitConfig.JitDoRedundantBranchOpts() != 0);
 
         if (opts.optRepeat)
         {
@@ -4631,6 +4643,13 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
                 EndPhase(PHASE_VN_COPY_PROP);
             }
 
+            if (doBranchOpt)
+            {
+                /* Remove branches implied by a dominating branch */
+                optRedundantBranches();
+                EndPhase(PHASE_OPTIMIZE_BRANCHES);
+            }
+
 #if FEATURE_ANYCSE
             /* Remove common sub-expressions */
             optOptimizeCSEs();
@@ -5757,7 +5776,8 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE            classPtr,
     compCurBB = nullptr;
     lvaTable  = nullptr;
 
-    // Reset node and block ID counter
+    // Reset method, node and block ID counter
+    compMethodID     = 0;
     compGenTreeID    = 0;
     compStatementID  = 0;
     compBasicBlockID = 0;
@@ -5921,11 +5941,13 @@ int Compiler::compCompileHelper(CORINFO_MODULE_HANDLE            classPtr,
 
     if (opts.disAsm || opts.dspEmit || verbose)
     {
-        s_compMethodsCount = ~info.compMethodHash() & 0xffff;
+        compMethodID = ~info.compMethodHash() & 0xffff;
     }
     else
     {
-        s_compMethodsCount++;
+        // Methods may be compiled concurrently, so the shared counter is only used
+        // to hand out the number; labels use this compiler's own copy.
+        compMethodID = (unsigned)InterlockedIncrement(&s_compMethodsCount);
     }
 #endif
 
@@ -3288,7 +3288,9 @@ public:
     void lvaUpdateClass(unsigned varNum, CORINFO_CLASS_HANDLE clsHnd, bool isExact = false);
     void lvaUpdateClass(unsigned varNum, GenTree* tree, CORINFO_CLASS_HANDLE stackHandle = nullptr);
 
-#define MAX_NumOfFieldsInPromotableStruct 4 // Maximum number of fields in promotable struct
+#define MAX_NumOfFieldsInPromotableStruct 8 // Maximum number of fields in promotable struct
+#define MAX_NumOfFieldsInCheapPromotableStruct 4 // Larger structs are only promoted if they pass extra cost checks
+#define MAX_NestedStructWrapperDepth 4 // Maximum nesting of single field structs promoted as a scalar
 
     // Info about struct type fields.
     struct lvaStructFieldInfo
@@ -5772,7 +5774,8 @@ public:
     // "ambientWeight".
     void optEnsureUniqueHead(unsigned loopInd, unsigned ambientWeight);
 
-    void optUnrollLoops(); // Unrolls loops (needs to have cost info)
+    void optUnrollLoops();          // Unrolls loops (needs to have cost info)
+    bool optPartiallyUnrollLoops(); // Partially unrolls small single-block loops with unknown trip counts
 
 protected:
     // This enumeration describes what is killed by a call.
@@ -6304,6 +6307,16 @@ public:
     void optVnCopyProp();
     INDEBUG(void optDumpCopyPropStack(LclNumToGenTreePtrStack* curSsaName));
 
+    // Redundant branch elimination.
+    void optRedundantBranches();
+    bool optRedundantBranch(BasicBlock* const block);
+    ValueNum optReverseRelopVN(ValueNum relopVN);
+    bool optReachable(BasicBlock* const fromBlock, BasicBlock* const toBlock, BasicBlock* const excludedBlock);
+
+    // Visited set for optReachable, sized for the blocks that exist during optRedundantBranches
+    BitVecTraits* optReachableBitVecTraits;
+    BitVec        optReachableBitVec;
+
     /**************************************************************************
     *               Early value propagation
     *************************************************************************/
@@ -8559,15 +8572,12 @@ public:
     } opts;
 
 #ifdef ALT_JIT
-    static bool                s_pAltJitExcludeAssembliesListInitialized;
     static AssemblyNamesList2* s_pAltJitExcludeAssembliesList;
 #endif // ALT_JIT
 
 #ifdef DEBUG
-    static bool                s_pJitDisasmIncludeAssembliesListInitialized;
     static AssemblyNamesList2* s_pJitDisasmIncludeAssembliesList;
 
-    static bool       s_pJitFunctionFileInitialized;
     static MethodSet* s_pJitMethodSet;
 #endif // DEBUG
 
@@ -8932,10 +8942,11 @@ public:
 //-------------------------- Global Compiler Data ------------------------------------
 
 #ifdef DEBUG
-    static unsigned s_compMethodsCount; // to produce unique label names
-    unsigned        compGenTreeID;
-    unsigned        compStatementID;
-    unsigned        compBasicBlockID;
+    static LONG s_compMethodsCount; // to produce unique method numbers
+    unsigned    compMethodID;       // to produce unique label names
+    unsigned    compGenTreeID;
+    unsigned    compStatementID;
+    unsigned    compBasicBlockID;
 #endif
 
     BasicBlock* compCurBB;   // the current basic block in process
@@ -8993,8 +9004,9 @@ public:
 
     //-------------------------------------------------------------------------
 
-    static void compStartup();  // One-time initialization
-    static void compShutdown(); // One-time finalization
+    static void compStartup();         // One-time initialization
+    static void compShutdown();        // One-time finalization
+    static void compInitConfigLists(); // One-time read of the config-specified assembly and method lists
 
     void compInit(ArenaAllocator* pAlloc, InlineInfo* inlineInfo);
     void compDone();
@@ -50,6 +50,11 @@ bool IsBMIInstruction(instruction ins)
     return (ins >= INS_FIRST_BMI_INSTRUCTION) && (ins <= INS_LAST_BMI_INSTRUCTION);
 }
 
+bool IsAVX512Instruction(instruction ins)
+{
+    return (ins >= INS_FIRST_AVX512_INSTRUCTION) && (ins <= INS_LAST_AVX512_INSTRUCTION);
+}
+
 regNumber getBmiRegNumber(instruction ins)
 {
     switch (ins)
@@ -107,10 +112,23 @@ regNumber getSseShiftRegNumber(instruction ins)
 
         case INS_psrad:
         case INS_psraw:
+        case INS_vpsraq:
         {
             return (regNumber)4;
         }
 
+        case INS_vprold:
+        case INS_vprolq:
+        {
+            return (regNumber)1;
+        }
+
+        case INS_vprord:
+        case INS_vprorq:
+        {
+            return (regNumber)0;
+        }
+
         default:
         {
             assert(!"Invalid instruction for SSE2 instruction of the form: opcode reg, immed8");
@@ -312,9 +330,21 @@ bool emitter::TakesVexPrefix(instruction ins)
 //   01  - 66     (66 0F - packed double)
 //   10  - F3     (F3 0F - scalar float
 //   11  - F2     (F2 0F - scalar double)
+//
+// AVX-512 instructions use the 4-byte EVEX prefix instead. It is a superset of the 3-byte VEX prefix
+// whose first two payload bytes line up with the VEX ones, so it is carried one byte higher in the
+// encoding and the same R, X, B, W, vvvv, L, pp and m-mmmmm handling applies to it.
+//
+// 4-byte EVEX prefix = 62 <R,X,B,R',0,0,m,m> <W,vvvv,1,pp> <z,L',L,b,V',aaa>
+//  - R' and V' (inverted) - the high bits of the register specifiers for xmm16-31, which we don't use
+//  - L'L - 00 for 128-bit and 01 for 256-bit operations
+//  - z, b, aaa - zeroing/merging, broadcast/rounding and opmask register; always zero (no masking)
 #define DEFAULT_3BYTE_VEX_PREFIX 0xC4E07800000000ULL
 #define DEFAULT_3BYTE_VEX_PREFIX_MASK 0xFFFFFF00000000ULL
 #define LBIT_IN_3BYTE_VEX_PREFIX 0x00000400000000ULL
+#define DEFAULT_EVEX_PREFIX 0x62F07C0800000000ULL
+#define DEFAULT_EVEX_PREFIX_MASK 0xFFFFFFFF00000000ULL
+#define LBIT_IN_EVEX_PREFIX 0x0000002000000000ULL
 emitter::code_t emitter::AddVexPrefix(instruction ins, code_t code, emitAttr attr)
 {
     // The 2-byte VEX encoding is preferred when possible, but actually emitting
@@ -330,6 +360,21 @@ emitter::code_t emitter::AddVexPrefix(instruction ins, code_t code, emitAttr att
     // Shouldn't have already added VEX prefix
     assert(!hasVexPrefix(code));
 
+    if (IsAVX512Instruction(ins))
+    {
+        assert((code & DEFAULT_EVEX_PREFIX_MASK) == 0);
+
+        code |= DEFAULT_EVEX_PREFIX;
+
+        if (attr == EA_32BYTE)
+        {
+            // Set L'L to 01 in case of instructions that operate on 256-bits.
+            code |= LBIT_IN_EVEX_PREFIX;
+        }
+
+        return code;
+    }
+
     assert((code & DEFAULT_3BYTE_VEX_PREFIX_MASK) == 0);
 
     code |= DEFAULT_3BYTE_VEX_PREFIX;
@@ -356,6 +401,17 @@ bool TakesRexWPrefix(instruction ins, emitAttr attr)
         case INS_vpermq:
         case INS_vpsrlvq:
         case INS_vpsllvq:
+        case INS_vpabsq:
+        case INS_vpmaxsq:
+        case INS_vpmaxuq:
+        case INS_vpminsq:
+        case INS_vpminuq:
+        case INS_vprolq:
+        case INS_vprorq:
+        case INS_vprolvq:
+        case INS_vprorvq:
+        case INS_vpsraq:
+        case INS_vpsravq:
         case INS_pinsrq:
         case INS_pextrq:
         case INS_vfmadd132pd:
@@ -549,6 +605,12 @@ emitter::code_t emitter::AddRexWPrefix(instruction ins, code_t code)
             assert(hasVexPrefix(code));
 
             // W-bit is the only bit that is added in non bit-inverted form.
+            if (hasEvexPrefix(code))
+            {
+                // The EVEX prefix carries the same bit one byte higher.
+                return emitter::code_t(code | 0x0000800000000000ULL);
+            }
+
             return emitter::code_t(code | 0x00008000000000ULL);
         }
     }
@@ -572,6 +634,12 @@ emitter::code_t emitter::AddRexRPrefix(instruction ins, code_t code)
             assert(hasVexPrefix(code));
 
             // R-bit is added in bit-inverted form.
+            if (hasEvexPrefix(code))
+            {
+                // The EVEX prefix carries the same bit one byte higher.
+                return code & 0xFF7FFFFFFFFFFFFFULL;
+            }
+
             return code & 0xFF7FFFFFFFFFFFULL;
         }
     }
@@ -589,6 +657,12 @@ emitter::code_t emitter::AddRexXPrefix(instruction ins, code_t code)
             assert(hasVexPrefix(code));
 
             // X-bit is added in bit-inverted form.
+            if (hasEvexPrefix(code))
+            {
+                // The EVEX prefix carries the same bit one byte higher.
+                return code & 0xFFBFFFFFFFFFFFFFULL;
+            }
+
             return code & 0xFFBFFFFFFFFFFFULL;
         }
     }
@@ -606,6 +680,12 @@ emitter::code_t emitter::AddRexBPrefix(instruction ins, code_t code)
             assert(hasVexPrefix(code));
 
             // B-bit is added in bit-inverted form.
+            if (hasEvexPrefix(code))
+            {
+                // The EVEX prefix carries the same bit one byte higher.
+                return code & 0xFFDFFFFFFFFFFFFFULL;
+            }
+
             return code & 0xFFDFFFFFFFFFFFULL;
         }
     }
@@ -647,6 +727,17 @@ unsigned emitter::emitOutputRexOrVexPrefixIfNeeded(instruction ins, BYTE* dst, c
         // Only AVX instructions should have a VEX prefix
         assert(UseVEXEncoding() && IsAVXInstruction(ins));
         code_t vexPrefix = (code >> 32) & 0x00FFFFFF;
+        BYTE   evexP2    = 0;
+
+        if (hasEvexPrefix(code))
+        {
+            // The first three bytes of the EVEX prefix are laid out like the 3-byte VEX
+            // prefix, so fix them up the same way and output the fourth byte as is.
+            assert(IsAVX512Instruction(ins));
+            vexPrefix = (code >> 40) & 0x00FFFFFF;
+            evexP2    = (code >> 32) & 0xFF;
+        }
+
         code &= 0x00000000FFFFFFFFLL;
 
         WORD leadingBytes = 0;
@@ -765,6 +856,17 @@ unsigned emitter::emitOutputRexOrVexPrefixIfNeeded(instruction ins, BYTE* dst, c
         //
         // Now output VEX prefix leaving the 4-byte opcode
 
+        if (IsAVX512Instruction(ins))
+        {
+            assert(((vexPrefix >> 16) & 0xFF) == 0x62);
+
+            emitOutputByte(dst, 0x62);
+            emitOutputByte(dst + 1, ((vexPrefix >> 8) & 0xFF));
+            emitOutputByte(dst + 2, vexPrefix & 0xFF);
+            emitOutputByte(dst + 3, evexP2);
+            return 4;
+        }
+
         // The 2-byte VEX encoding, requires that the X and B-bits are set (these
         // bits are inverted from the REX values so set means off), the W-bit is
         // not set (this bit is not inverted), and that the m-mmmm bits are 0-0001
@@ -903,7 +1005,8 @@ unsigned emitter::emitGetVexPrefixSize(instruction ins, emitAttr attr)
 {
     if (IsAVXInstruction(ins))
     {
-        return 3;
+        // AVX-512 instructions use the 4-byte EVEX prefix.
+        return IsAVX512Instruction(ins) ? 4 : 3;
     }
 
     // If not AVX, then we don't need to encode vex prefix.
@@ -939,7 +1042,7 @@ unsigned emitter::emitGetAdjustedSize(instruction ins, emitAttr attr, code_t cod
         //  = opcodeSize + vexPrefixAdjustedSize
 
         unsigned vexPrefixAdjustedSize = emitGetVexPrefixSize(ins, attr);
-        assert(vexPrefixAdjustedSize == 3);
+        assert(vexPrefixAdjustedSize == (IsAVX512Instruction(ins) ? 4u : 3u));
 
         // In this case, opcode will contains escape prefix at least one byte,
         // vexPrefixAdjustedSize should be minus one.
@@ -995,6 +1098,11 @@ unsigned emitter::emitGetAdjustedSize(instruction ins, emitAttr attr, code_t cod
 // Get size of rex or vex prefix emitted in code
 unsigned emitter::emitGetPrefixSize(code_t code)
 {
+    if (hasEvexPrefix(code))
+    {
+        return 4;
+    }
+
     if (hasVexPrefix(code))
     {
         return 3;
@@ -1508,8 +1616,9 @@ inline emitter::code_t emitter::insEncodeReg3456(instruction ins, regNumber reg,
 
     // VEX prefix encodes register operand in 1's complement form
     // Shift count = 4-bytes of opcode + 0-2 bits
+    // The EVEX prefix carries vvvv in the same bits, one byte higher.
     assert(regBits <= 0xF);
-    regBits <<= 35;
+    regBits <<= (hasEvexPrefix(code) ? 43 : 35);
     return code ^ regBits;
 }
 
@@ -4057,6 +4166,11 @@ void emitter::emitIns_R_R_I(instruction ins, emitAttr attr, regNumber reg1, regN
 
         case INS_psrldq:
         case INS_pslldq:
+        case INS_vprold:
+        case INS_vprolq:
+        case INS_vprord:
+        case INS_vprorq:
+        case INS_vpsraq:
         {
             code = insCodeMI(ins);
             break;
@@ -4539,6 +4653,11 @@ void emitter::emitIns_R_R_R_I(
 
         case INS_psrldq:
         case INS_pslldq:
+        case INS_vprold:
+        case INS_vprolq:
+        case INS_vprord:
+        case INS_vprorq:
+        case INS_vpsraq:
         {
             code = insCodeMI(ins);
             break;
@@ -7853,7 +7972,7 @@ void emitter::emitDispAddrMode(instrDesc* id, bool noDetail)
             {
                 printf("reloc ");
             }
-            printf("J_M%03u_DS%02u", Compiler::s_compMethodsCount, id->idDebugOnlyInfo()->idMemCookie);
+            printf("J_M%03u_DS%02u", emitComp->compMethodID, id->idDebugOnlyInfo()->idMemCookie);
 
             disp -= id->idDebugOnlyInfo()->idMemCookie;
         }
@@ -7991,7 +8110,7 @@ void emitter::emitDispAddrMode(instrDesc* id, bool noDetail)
 #else
 #define SIZE_LETTER "D"
 #endif
-        printf("\n\n    J_M%03u_DS%02u LABEL   " SIZE_LETTER "WORD", Compiler::s_compMethodsCount, jtno);
+        printf("\n\n    J_M%03u_DS%02u LABEL   " SIZE_LETTER "WORD", emitComp->compMethodID, jtno);
 
         /* Display the label table (it's stored as "BasicBlock*" values) */
 
@@ -8004,7 +8123,7 @@ void emitter::emitDispAddrMode(instrDesc* id, bool noDetail)
             lab = (insGroup*)emitCodeGetCookie(*bbp++);
             assert(lab);
 
-            printf("\n            D" SIZE_LETTER "      G_M%03u_IG%02u", Compiler::s_compMethodsCount, lab->igNum);
+            printf("\n            D" SIZE_LETTER "      G_M%03u_IG%02u", emitComp->compMethodID, lab->igNum);
         } while (--cnt);
     }
 }
@@ -9068,11 +9187,11 @@ void emitter::emitDispIns(
 
             if (id->idIsBound())
             {
-                printf("G_M%03u_IG%02u", Compiler::s_compMethodsCount, id->idAddr()->iiaIGlabel->igNum);
+                printf("G_M%03u_IG%02u", emitComp->compMethodID, id->idAddr()->iiaIGlabel->igNum);
             }
             else
             {
-                printf("L_M%03u_" FMT_BB, Compiler::s_compMethodsCount, id->idAddr()->iiaBBlabel->bbNum);
+                printf("L_M%03u_" FMT_BB, emitComp->compMethodID, id->idAddr()->iiaBBlabel->bbNum);
             }
             break;
 
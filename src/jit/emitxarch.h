@@ -113,10 +113,20 @@ bool hasRexPrefix(code_t code)
 
 bool TakesVexPrefix(instruction ins);
 
-// Returns true if the instruction encoding already contains VEX prefix
+// 4-byte EVEX prefix starts with byte 0x62
+#define EVEX_PREFIX_MASK 0xFF00000000000000ULL
+#define EVEX_PREFIX_CODE 0x6200000000000000ULL
+
+// Returns true if the instruction encoding already contains EVEX prefix
+bool hasEvexPrefix(code_t code)
+{
+    return (code & EVEX_PREFIX_MASK) == EVEX_PREFIX_CODE;
+}
+
+// Returns true if the instruction encoding already contains VEX (or EVEX) prefix
 bool hasVexPrefix(code_t code)
 {
-    return (code & VEX_PREFIX_MASK_3BYTE) == VEX_PREFIX_CODE_3BYTE;
+    return ((code & VEX_PREFIX_MASK_3BYTE) == VEX_PREFIX_CODE_3BYTE) || hasEvexPrefix(code);
 }
 code_t AddVexPrefix(instruction ins, code_t code, emitAttr attr);
 code_t AddVexPrefixIfNeeded(instruction ins, code_t code, emitAttr size)
@@ -218,6 +218,8 @@ GTNODE(JCC              , GenTreeCC          ,0,(GTK_LEAF|GTK_NOVALUE))   // Che
                                                                         // by GenTreeCC::gtCondition is true.
 GTNODE(SETCC            , GenTreeCC          ,0,GTK_LEAF)               // Checks the condition flags and produces 1 if the condition specified 
                                                                         // by GenTreeCC::gtCondition is true and 0 otherwise.
+GTNODE(SELECTCC         , GenTreeOpCC        ,0,GTK_BINOP)              // Checks the condition flags and produces op1 if the condition specified
+                                                                        // by GenTreeOpCC::gtCondition is true and op2 otherwise.
 #ifdef _TARGET_XARCH_
 GTNODE(BT               , GenTreeOp          ,0,(GTK_BINOP|GTK_NOVALUE))  // The XARCH BT instruction. Like CMP, this sets the condition flags (CF
                                                                         // to be precise) and does not produce a value.
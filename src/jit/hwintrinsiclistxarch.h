@@ -522,6 +522,21 @@ HARDWARE_INTRINSIC(AVX2_UnpackHigh,                                 "UnpackHigh"
 HARDWARE_INTRINSIC(AVX2_UnpackLow,                                  "UnpackLow",                                    AVX2,         -1,              32,           2,     {INS_punpcklbw,         INS_punpcklbw,      INS_punpcklwd,      INS_punpcklwd,      INS_punpckldq,      INS_punpckldq,      INS_punpcklqdq,     INS_punpcklqdq,     INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_NoFlag)
 HARDWARE_INTRINSIC(AVX2_Xor,                                        "Xor",                                          AVX2,         -1,              32,           2,     {INS_pxor,              INS_pxor,           INS_pxor,           INS_pxor,           INS_pxor,           INS_pxor,           INS_pxor,           INS_pxor,           INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_Commutative)
 
+// ***************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************
+//                 Intrinsic ID                                     Function name                                   ISA         ival        SIMD size       NumArg                                                                                                     instructions                                                                                                     Category                            Flags
+//                                                                                                                                                                      {TYP_BYTE,              TYP_UBYTE,          TYP_SHORT,          TYP_USHORT,         TYP_INT,            TYP_UINT,           TYP_LONG,           TYP_ULONG,          TYP_FLOAT,          TYP_DOUBLE}
+// ***************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************
+//  AVX512F Intrinsics
+HARDWARE_INTRINSIC(AVX512F_Abs,                                    "Abs",                                          AVX512F,      -1,               0,           1,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_vpabsq,         INS_vpabsq,         INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_NoRMWSemantics)
+HARDWARE_INTRINSIC(AVX512F_Max,                                    "Max",                                          AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_vpmaxsq,        INS_vpmaxuq,        INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_Commutative)
+HARDWARE_INTRINSIC(AVX512F_Min,                                    "Min",                                          AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_vpminsq,        INS_vpminuq,        INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_Commutative)
+HARDWARE_INTRINSIC(AVX512F_RotateLeft,                             "RotateLeft",                                   AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_vprold,         INS_vprold,         INS_vprolq,         INS_vprolq,         INS_invalid,        INS_invalid},           HW_Category_IMM,                    HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_FullRangeIMM)
+HARDWARE_INTRINSIC(AVX512F_RotateLeftVariable,                     "RotateLeftVariable",                           AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_vprolvd,        INS_vprolvd,        INS_vprolvq,        INS_vprolvq,        INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment)
+HARDWARE_INTRINSIC(AVX512F_RotateRight,                            "RotateRight",                                  AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_vprord,         INS_vprord,         INS_vprorq,         INS_vprorq,         INS_invalid,        INS_invalid},           HW_Category_IMM,                    HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_FullRangeIMM)
+HARDWARE_INTRINSIC(AVX512F_RotateRightVariable,                    "RotateRightVariable",                          AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_vprorvd,        INS_vprorvd,        INS_vprorvq,        INS_vprorvq,        INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment)
+HARDWARE_INTRINSIC(AVX512F_ShiftRightArithmetic,                   "ShiftRightArithmetic",                         AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_vpsraq,         INS_invalid,        INS_invalid,        INS_invalid},           HW_Category_IMM,                    HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment|HW_Flag_FullRangeIMM)
+HARDWARE_INTRINSIC(AVX512F_ShiftRightArithmeticVariable,           "ShiftRightArithmeticVariable",                 AVX512F,      -1,               0,           2,     {INS_invalid,           INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_invalid,        INS_vpsravq,        INS_invalid,        INS_invalid,        INS_invalid},           HW_Category_SimpleSIMD,             HW_Flag_UnfixedSIMDSize|HW_Flag_NoContainment)
+
 // ***************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************************
 //                 Intrinsic ID                                     Function name                                   ISA         ival        SIMD size       NumArg                                                                                                     instructions                                                                                                     Category                            Flags
 //                                                                                                                                                                      {TYP_BYTE,              TYP_UBYTE,          TYP_SHORT,          TYP_USHORT,         TYP_INT,            TYP_UINT,           TYP_LONG,           TYP_ULONG,          TYP_FLOAT,          TYP_DOUBLE}
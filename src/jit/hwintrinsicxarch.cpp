@@ -145,6 +145,10 @@ static InstructionSet lookupInstructionSet(const char* className)
         {
             return InstructionSet_AVX2;
         }
+        if (strcmp(className, "Avx512F") == 0)
+        {
+            return InstructionSet_AVX512F;
+        }
     }
     else if (className[0] == 'S')
     {
@@ -527,6 +531,7 @@ bool HWIntrinsicInfo::isFullyImplementedIsa(InstructionSet isa)
         case InstructionSet_AES:
         case InstructionSet_AVX:
         case InstructionSet_AVX2:
+        case InstructionSet_AVX512F:
         case InstructionSet_BMI1:
         case InstructionSet_BMI2:
         case InstructionSet_BMI1_X64:
@@ -85,6 +85,14 @@ InlinePolicy* InlinePolicy::GetPolicy(Compiler* compiler, bool isPrejitRoot)
         return new (compiler, CMK_Inlining) ModelPolicy(compiler, isPrejitRoot);
     }
 
+    // Optionally install the ProfilePolicy.
+    bool useProfilePolicy = JitConfig.JitInlinePolicyProfile() != 0;
+
+    if (useProfilePolicy)
+    {
+        return new (compiler, CMK_Inlining) ProfilePolicy(compiler, isPrejitRoot);
+    }
+
     // Use the default policy by default
     return new (compiler, CMK_Inlining) DefaultPolicy(compiler, isPrejitRoot);
 }
@@ -2152,6 +2160,350 @@ void ModelPolicy::DetermineProfitability(CORINFO_METHOD_INFO* methodInfo)
     }
 }
 
+double        ProfilePolicy::s_ModelTable[MODEL_COUNT];
+double*       ProfilePolicy::s_Model = nullptr;
+CritSecObject ProfilePolicy::s_ModelLock;
+
+//------------------------------------------------------------------------/
+// ProfilePolicy: construct a new ProfilePolicy
+//
+// Arguments:
+//    compiler -- compiler instance doing the inlining (root compiler)
+//    isPrejitRoot -- true if this compiler is prejitting the root method
+
+ProfilePolicy::ProfilePolicy(Compiler* compiler, bool isPrejitRoot)
+    : DiscretionaryPolicy(compiler, isPrejitRoot)
+    , m_Model(GetModel())
+    , m_ProfileCallSiteWeight(0.0)
+    , m_ModelScore(0.0)
+{
+}
+
+//------------------------------------------------------------------------
+// GetModel: get the model coefficients
+//
+// Return Value:
+//    Array of MODEL_COUNT coefficients, in MODEL_* order.
+//
+// Notes:
+//    JitInlineProfileModel is parsed once, by the first ProfilePolicy
+//    to ask for the model, and the coefficients are shared by all
+//    later policies.
+
+const double* ProfilePolicy::GetModel()
+{
+    double* model = s_Model;
+
+    if (model == nullptr)
+    {
+        CritSecHolder modelLock(s_ModelLock);
+
+        model = s_Model;
+
+        if (model == nullptr)
+        {
+            ParseModel(JitConfig.JitInlineProfileModel(), s_ModelTable);
+
+            // Publish the table only once it is filled in.
+            model = s_ModelTable;
+            InterlockedCompareExchangeT(&s_Model, model, (double*)nullptr);
+        }
+    }
+
+    return model;
+}
+
+//------------------------------------------------------------------------
+// ParseModel: set up the model coefficients
+//
+// Arguments:
+//    model        -- JitInlineProfileModel setting, or nullptr
+//    coefficients -- [out] array of MODEL_COUNT coefficients
+//
+// Notes:
+//    The default coefficients reproduce the ModelPolicy decision:
+//    inline when weight * benefit - 0.2 * size > 0, which is the
+//    ModelPolicy threshold of 0.2 instructions saved per byte.
+//
+//    JitInlineProfileModel may supply replacement coefficients as a
+//    comma separated list of decimal numbers, in MODEL_* order. Missing
+//    trailing values keep their defaults, so the list can be extended
+//    without invalidating older settings. Parsing stops at the first
+//    malformed entry.
+
+void ProfilePolicy::ParseModel(const WCHAR* model, double* coefficients)
+{
+    coefficients[MODEL_BIAS]                 = 0.0;
+    coefficients[MODEL_WEIGHTED_BENEFIT]     = 1.0;
+    coefficients[MODEL_SIZE]                 = -0.2;
+    coefficients[MODEL_CALLSITE_WEIGHT]      = 0.0;
+    coefficients[MODEL_CONST_ARG_FEEDS_TEST] = 0.0;
+    coefficients[MODEL_CALLSITE_IN_LOOP]     = 0.0;
+
+    if (model == nullptr)
+    {
+        return;
+    }
+
+    for (unsigned i = 0; (i < MODEL_COUNT) && (*model != W('\0')); i++)
+    {
+        while (*model == W(' '))
+        {
+            model++;
+        }
+
+        bool negative = false;
+
+        if ((*model == W('-')) || (*model == W('+')))
+        {
+            negative = (*model == W('-'));
+            model++;
+        }
+
+        double value     = 0.0;
+        double scale     = 1.0;
+        bool   sawDigit  = false;
+        bool   sawPeriod = false;
+
+        for (;; model++)
+        {
+            if ((*model >= W('0')) && (*model <= W('9')))
+            {
+                sawDigit = true;
+
+                if (sawPeriod)
+                {
+                    scale /= 10.0;
+                    value += scale * (*model - W('0'));
+                }
+                else
+                {
+                    value = value * 10.0 + (*model - W('0'));
+                }
+            }
+            else if ((*model == W('.')) && !sawPeriod)
+            {
+                sawPeriod = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        while (*model == W(' '))
+        {
+            model++;
+        }
+
+        if (!sawDigit || ((*model != W(',')) && (*model != W('\0'))))
+        {
+            return;
+        }
+
+        coefficients[i] = negative ? -value : value;
+
+        if (*model == W(','))
+        {
+            model++;
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// NoteInt: handle an observed integer value
+//
+// Arguments:
+//    obs      - the current obsevation
+//    value    - the value being observed
+//
+// Notes:
+//    Unlike the ModelPolicy, the size cutoff can't be derived from the
+//    model since the coefficients are configurable, so the usual
+//    inline IL size limit is used for early rejection.
+
+void ProfilePolicy::NoteInt(InlineObservation obs, int value)
+{
+    // Let underlying policy do its thing.
+    DiscretionaryPolicy::NoteInt(obs, value);
+
+    // Fail fast for inlinees that are too large to ever inline.
+    if (!m_IsForceInline && (obs == InlineObservation::CALLEE_IL_CODE_SIZE) &&
+        (static_cast<unsigned>(value) > m_RootCompiler->m_inlineStrategy->GetMaxInlineILSize()))
+    {
+        // Callee too big, not a candidate
+        SetNever(InlineObservation::CALLEE_TOO_MUCH_IL);
+        return;
+    }
+
+    // Safeguard against overly deep inlines
+    if (obs == InlineObservation::CALLSITE_DEPTH)
+    {
+        unsigned depthLimit = m_RootCompiler->m_inlineStrategy->GetMaxInlineDepth();
+
+        if (m_Depth > depthLimit)
+        {
+            SetFailure(InlineObservation::CALLSITE_IS_TOO_DEEP);
+            return;
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+// EstimateCallSiteWeight: estimate how often the call site runs per
+// call to the root method
+//
+// Return Value:
+//    Relative call site weight, where 1.0 means the call site runs
+//    once per call to the root method.
+//
+// Notes:
+//    When the root method has profile data (IBC or instrumented tier0
+//    counts), the call site block weight is compared to the weight of
+//    the root method entry. Otherwise the block weight is the static
+//    estimate (loop nesting, rarely run blocks) relative to
+//    BB_UNITY_WEIGHT. The result is capped so a single very hot site
+//    can't justify an arbitrarily large inline.
+
+double ProfilePolicy::EstimateCallSiteWeight() const
+{
+    const double maxWeight = 64.0;
+
+    if (m_IsPrejitRoot)
+    {
+        // No particular call site; assume a typical one.
+        return 1.0;
+    }
+
+    double entryWeight = BB_UNITY_WEIGHT;
+
+    if (m_RootCompiler->fgHaveProfileData())
+    {
+        BasicBlock::weight_t firstWeight = m_RootCompiler->fgFirstBB->bbWeight;
+
+        if (firstWeight == BB_ZERO_WEIGHT)
+        {
+            // The root method was never called during profiling.
+            return (m_CallSiteWeight == BB_ZERO_WEIGHT) ? 0.0 : 1.0;
+        }
+
+        entryWeight = firstWeight;
+    }
+
+    double weight = (double)m_CallSiteWeight / entryWeight;
+
+    return (weight > maxWeight) ? maxWeight : weight;
+}
+
+//------------------------------------------------------------------------
+// DetermineProfitability: determine if this inline is profitable
+//
+// Arguments:
+//    methodInfo -- method info for the callee
+
+void ProfilePolicy::DetermineProfitability(CORINFO_METHOD_INFO* methodInfo)
+{
+    // Do some homework
+    MethodInfoObservations(methodInfo);
+    EstimateCodeSize();
+    EstimatePerformanceImpact();
+
+    m_ProfileCallSiteWeight = EstimateCallSiteWeight();
+
+    // The per call instruction estimate is negative if the inline
+    // will reduce instruction count. Flip the sign here to make
+    // positive be better.
+    const double perCallSavings = -(double)m_PerCallInstructionEstimate / SIZE_SCALE;
+    const double sizeEstimate   = (double)m_ModelCodeSizeEstimate / SIZE_SCALE;
+
+    // clang-format off
+    m_ModelScore =
+        m_Model[MODEL_BIAS] +
+        m_Model[MODEL_WEIGHTED_BENEFIT]     * m_ProfileCallSiteWeight * perCallSavings +
+        m_Model[MODEL_SIZE]                 * sizeEstimate +
+        m_Model[MODEL_CALLSITE_WEIGHT]      * m_ProfileCallSiteWeight +
+        m_Model[MODEL_CONST_ARG_FEEDS_TEST] * (m_ConstantArgFeedsConstantTest > 0 ? 1 : 0) +
+        m_Model[MODEL_CALLSITE_IN_LOOP]     * (m_CallsiteIsInLoop ? 1 : 0);
+    // clang-format on
+
+    JITLOG_THIS(m_RootCompiler,
+                (LL_INFO100000, "Inline %s profitable: score=%g (weight=%g, percall=%g, size=%g)\n",
+                 (m_ModelScore > 0.0) ? "is" : "is not", m_ModelScore, m_ProfileCallSiteWeight, perCallSavings,
+                 sizeEstimate));
+
+    if (m_ModelCodeSizeEstimate <= 0)
+    {
+        // Inline will likely decrease code size
+        if (m_IsPrejitRoot)
+        {
+            SetCandidate(InlineObservation::CALLEE_IS_SIZE_DECREASING_INLINE);
+        }
+        else
+        {
+            SetCandidate(InlineObservation::CALLSITE_IS_SIZE_DECREASING_INLINE);
+        }
+    }
+    else if (m_ModelScore > 0.0)
+    {
+        if (m_IsPrejitRoot)
+        {
+            SetCandidate(InlineObservation::CALLEE_IS_PROFITABLE_INLINE);
+        }
+        else
+        {
+            SetCandidate(InlineObservation::CALLSITE_IS_PROFITABLE_INLINE);
+        }
+    }
+    else
+    {
+        if (m_IsPrejitRoot)
+        {
+            SetNever(InlineObservation::CALLEE_NOT_PROFITABLE_INLINE);
+        }
+        else
+        {
+            SetFailure(InlineObservation::CALLSITE_NOT_PROFITABLE_INLINE);
+        }
+    }
+}
+
+#if defined(DEBUG) || defined(INLINE_DATA)
+
+//------------------------------------------------------------------------
+// DumpSchema: dump names for all the supporting data for the
+// inline decision in CSV format.
+//
+// Arguments:
+//    file -- file to write to
+//
+// Notes:
+//    Extends the DiscretionaryPolicy schema with the model inputs that
+//    are not already present, so JitInlineDumpData output can be used
+//    to refit the JitInlineProfileModel coefficients.
+
+void ProfilePolicy::DumpSchema(FILE* file) const
+{
+    DiscretionaryPolicy::DumpSchema(file);
+    fprintf(file, ",ProfileCallSiteWeight");
+    fprintf(file, ",ProfileModelScore");
+}
+
+//------------------------------------------------------------------------
+// DumpData: dump all the supporting data for the inline decision
+// in CSV format.
+//
+// Arguments:
+//    file -- file to write to
+
+void ProfilePolicy::DumpData(FILE* file) const
+{
+    DiscretionaryPolicy::DumpData(file);
+    fprintf(file, ",%g", m_ProfileCallSiteWeight);
+    fprintf(file, ",%g", m_ModelScore);
+}
+
+#endif // defined(DEBUG) || defined(INLINE_DATA)
+
 #if defined(DEBUG) || defined(INLINE_DATA)
 
 //------------------------------------------------------------------------/
@@ -13,6 +13,8 @@
 // DefaultPolicy        - default inliner policy
 // DiscretionaryPolicy  - default variant with uniform size policy
 // ModelPolicy          - policy based on statistical modelling
+// ProfilePolicy        - model policy with configurable coefficients and
+//                        profile-weighted call sites
 //
 // These experimental policies are available only in
 // DEBUG or release+INLINE_DATA builds of the jit.
@@ -305,6 +307,70 @@ public:
 #endif // defined(DEBUG) || defined(INLINE_DATA)
 };
 
+// ProfilePolicy is a variant of the ModelPolicy that scales the
+// per-call benefit by the relative execution weight of the call
+// site (using profile counts when the root method has them) and
+// scores candidates with a linear model whose coefficients can be
+// supplied via JitInlineProfileModel, so the model can be retrained
+// from JitInlineDumpData output without rebuilding the jit.
+
+class ProfilePolicy : public DiscretionaryPolicy
+{
+public:
+    // Construct a ProfilePolicy
+    ProfilePolicy(Compiler* compiler, bool isPrejitRoot);
+
+    // Policy observations
+    void NoteInt(InlineObservation obs, int value) override;
+
+    // Policy determinations
+    void DetermineProfitability(CORINFO_METHOD_INFO* methodInfo) override;
+
+    // Policy policies
+    bool PropagateNeverToRuntime() const override
+    {
+        return false;
+    }
+
+#if defined(DEBUG) || defined(INLINE_DATA)
+
+    // Externalize data
+    void DumpData(FILE* file) const override;
+    void DumpSchema(FILE* file) const override;
+
+    // Miscellaneous
+    const char* GetName() const override
+    {
+        return "ProfilePolicy";
+    }
+
+#endif // defined(DEBUG) || defined(INLINE_DATA)
+
+protected:
+    // Model inputs, in the order coefficients are given in JitInlineProfileModel
+    enum
+    {
+        MODEL_BIAS,                 // constant term
+        MODEL_WEIGHTED_BENEFIT,     // call site weight * instructions saved per call
+        MODEL_SIZE,                 // estimated code size increase in bytes
+        MODEL_CALLSITE_WEIGHT,      // call site weight
+        MODEL_CONST_ARG_FEEDS_TEST, // constant argument feeds a test in the callee
+        MODEL_CALLSITE_IN_LOOP,     // call site is in a loop
+        MODEL_COUNT
+    };
+
+    static const double* GetModel();
+    static void ParseModel(const WCHAR* model, double* coefficients);
+    double EstimateCallSiteWeight() const;
+
+    static double        s_ModelTable[MODEL_COUNT];
+    static double*       s_Model;
+    static CritSecObject s_ModelLock;
+    const double*        m_Model;
+    double               m_ProfileCallSiteWeight;
+    double               m_ModelScore;
+};
+
 #if defined(DEBUG) || defined(INLINE_DATA)
 
 // RandomPolicy implements a policy that inlines at random.
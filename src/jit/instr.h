@@ -310,6 +310,7 @@ enum InstructionSet
     InstructionSet_AVX2,
     // End linear order SIMD instruction sets.
     InstructionSet_AES,
+    InstructionSet_AVX512F,
     InstructionSet_BMI1,
     InstructionSet_BMI2,
     InstructionSet_FMA,
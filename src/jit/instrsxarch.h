@@ -599,6 +599,25 @@ INST3(mulx,             "mulx",             IUM_WR, BAD_CODE,     BAD_CODE,
 
 INST3(LAST_BMI_INSTRUCTION, "LAST_BMI_INSTRUCTION", IUM_WR, BAD_CODE, BAD_CODE, BAD_CODE, INS_FLAGS_None)
 
+// AVX-512F (EVEX encoded, 128-bit and 256-bit forms via AVX-512VL)
+INST3(FIRST_AVX512_INSTRUCTION, "FIRST_AVX512_INSTRUCTION", IUM_WR, BAD_CODE, BAD_CODE, BAD_CODE, INS_FLAGS_None)
+INST3(vpabsq,           "pabsq",            IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x1F),                             INS_FLAGS_None)    // Packed absolute value of 64-bit integers
+INST3(vpmaxsq,          "pmaxsq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x3D),                             INS_Flags_IsDstDstSrcAVXInstruction)    // packed maximum 64-bit signed integers
+INST3(vpmaxuq,          "pmaxuq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x3F),                             INS_Flags_IsDstDstSrcAVXInstruction)    // packed maximum 64-bit unsigned integers
+INST3(vpminsq,          "pminsq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x39),                             INS_Flags_IsDstDstSrcAVXInstruction)    // packed minimum 64-bit signed integers
+INST3(vpminuq,          "pminuq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x3B),                             INS_Flags_IsDstDstSrcAVXInstruction)    // packed minimum 64-bit unsigned integers
+INST3(vprold,           "prold",            IUM_WR, BAD_CODE,     PCKDBL(0x72), BAD_CODE,                                INS_Flags_IsDstDstSrcAVXInstruction)    // Packed rotate left of 32-bit integers by immediate
+INST3(vprolq,           "prolq",            IUM_WR, BAD_CODE,     PCKDBL(0x72), BAD_CODE,                                INS_Flags_IsDstDstSrcAVXInstruction)    // Packed rotate left of 64-bit integers by immediate
+INST3(vprord,           "prord",            IUM_WR, BAD_CODE,     PCKDBL(0x72), BAD_CODE,                                INS_Flags_IsDstDstSrcAVXInstruction)    // Packed rotate right of 32-bit integers by immediate
+INST3(vprorq,           "prorq",            IUM_WR, BAD_CODE,     PCKDBL(0x72), BAD_CODE,                                INS_Flags_IsDstDstSrcAVXInstruction)    // Packed rotate right of 64-bit integers by immediate
+INST3(vprolvd,          "prolvd",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x15),                             INS_Flags_IsDstDstSrcAVXInstruction)    // Variable Bit Rotate Left of 32-bit integers
+INST3(vprolvq,          "prolvq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x15),                             INS_Flags_IsDstDstSrcAVXInstruction)    // Variable Bit Rotate Left of 64-bit integers
+INST3(vprorvd,          "prorvd",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x14),                             INS_Flags_IsDstDstSrcAVXInstruction)    // Variable Bit Rotate Right of 32-bit integers
+INST3(vprorvq,          "prorvq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x14),                             INS_Flags_IsDstDstSrcAVXInstruction)    // Variable Bit Rotate Right of 64-bit integers
+INST3(vpsraq,           "psraq",            IUM_WR, BAD_CODE,     PCKDBL(0x72), BAD_CODE,                                INS_Flags_IsDstDstSrcAVXInstruction)    // Packed shift right arithmetic of 64-bit integers
+INST3(vpsravq,          "psravq",           IUM_WR, BAD_CODE,     BAD_CODE,     SSE38(0x46),                             INS_Flags_IsDstDstSrcAVXInstruction)    // Variable Bit Shift Right Arithmetic of 64-bit integers
+INST3(LAST_AVX512_INSTRUCTION, "LAST_AVX512_INSTRUCTION", IUM_WR, BAD_CODE, BAD_CODE, BAD_CODE, INS_FLAGS_None)
+
 INST3(LAST_AVX_INSTRUCTION, "LAST_AVX_INSTRUCTION", IUM_WR, BAD_CODE, BAD_CODE, BAD_CODE, INS_FLAGS_None)
 
 // Scalar instructions in SSE4.2
@@ -1632,8 +1632,9 @@ bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE
 #if defined(FEATURE_SIMD)
 #if defined(_TARGET_XARCH_)
     // This will allow promotion of 4 Vector<T> fields on AVX2 or Vector256<T> on AVX,
-    // or 8 Vector<T>/Vector128<T> fields on SSE2.
-    const int MaxOffset = MAX_NumOfFieldsInPromotableStruct * YMM_REGSIZE_BYTES;
+    // or 8 Vector<T>/Vector128<T> fields on SSE2. Note that the limit must still fit
+    // in the byte-sized field offset.
+    const int MaxOffset = MAX_NumOfFieldsInPromotableStruct * XMM_REGSIZE_BYTES;
 #elif defined(_TARGET_ARM64_)
     const int MaxOffset = MAX_NumOfFieldsInPromotableStruct * FP_REGSIZE_BYTES;
 #endif // defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
@@ -1877,6 +1878,17 @@ bool Compiler::StructPromotionHelper::ShouldPromoteStructVar(unsigned lclNum)
                 structPromotionInfo.fieldCnt, varDsc->lvFieldAccessed);
         shouldPromote = false;
     }
+    // Structs with more than a handful of fields are only worth promoting when the promoted
+    // fields can be used independently. Promoted params have to be reassembled field by field
+    // in the prolog (or from the implicit byref) and structs with holes need extra copies for
+    // block operations, so in those cases we keep the struct in memory.
+    else if ((structPromotionInfo.fieldCnt > MAX_NumOfFieldsInCheapPromotableStruct) &&
+             (structPromotionInfo.containsHoles || varDsc->lvIsParam))
+    {
+        JITDUMP("Not promoting promotable struct local V%02u: #fields = %d, containsHoles = %d, isParam = %d.\n",
+                lclNum, structPromotionInfo.fieldCnt, structPromotionInfo.containsHoles, varDsc->lvIsParam);
+        shouldPromote = false;
+    }
 #if defined(_TARGET_AMD64_) || defined(_TARGET_ARM64_) || defined(_TARGET_ARM_)
     // TODO-PERF - Only do this when the LclVar is used in an argument context
     // TODO-ARM64 - HFA support should also eliminate the need for this.
@@ -2020,24 +2032,51 @@ bool Compiler::StructPromotionHelper::TryPromoteStructField(lvaStructFieldInfo&
 
     COMP_HANDLE compHandle = compiler->info.compCompHnd;
 
-    // Do not promote if the struct field in turn has more than one field.
-    if (compHandle->getClassNumInstanceFields(fieldInfo.fldTypeHnd) != 1)
-    {
-        return false;
-    }
+    // Look through nested single field wrappers (e.g. a struct wrapping a struct wrapping an int)
+    // until we reach the scalar they wrap.
+    CORINFO_CLASS_HANDLE wrapperTypeHnd = fieldInfo.fldTypeHnd;
+    var_types            fieldVarType   = TYP_UNDEF;
+    unsigned             nestingDepth   = 0;
 
-    // Do not promote if the single field is not aligned at its natural boundary within
-    // the struct field.
-    CORINFO_FIELD_HANDLE innerFieldHndl   = compHandle->getFieldInClass(fieldInfo.fldTypeHnd, 0);
-    unsigned             innerFieldOffset = compHandle->getFieldOffset(innerFieldHndl);
-    if (innerFieldOffset != 0)
+    while (true)
     {
-        return false;
+        // Do not promote if the struct field in turn has more than one field.
+        if (compHandle->getClassNumInstanceFields(wrapperTypeHnd) != 1)
+        {
+            return false;
+        }
+
+        // Do not promote if the single field is not aligned at its natural boundary within
+        // the struct field.
+        CORINFO_FIELD_HANDLE innerFieldHndl   = compHandle->getFieldInClass(wrapperTypeHnd, 0);
+        unsigned             innerFieldOffset = compHandle->getFieldOffset(innerFieldHndl);
+        if (innerFieldOffset != 0)
+        {
+            return false;
+        }
+
+        CORINFO_CLASS_HANDLE innerTypeHnd = nullptr;
+        CorInfoType          fieldCorType = compHandle->getFieldType(innerFieldHndl, &innerTypeHnd);
+        fieldVarType                      = JITtype2varType(fieldCorType);
+
+        if (fieldVarType != TYP_STRUCT)
+        {
+            break;
+        }
+
+        // The nested wrapper must occupy all of its parent storage as well.
+        if ((++nestingDepth > MAX_NestedStructWrapperDepth) ||
+            (compHandle->getClassSize(innerTypeHnd) != compHandle->getClassSize(wrapperTypeHnd)))
+        {
+            JITDUMP("Promotion blocked: struct contains nested struct wrappers that are too deep"
+                    " or do not fill their parent.\n");
+            return false;
+        }
+
+        wrapperTypeHnd = innerTypeHnd;
     }
 
-    CorInfoType fieldCorType = compHandle->getFieldType(innerFieldHndl);
-    var_types   fieldVarType = JITtype2varType(fieldCorType);
-    unsigned    fieldSize    = genTypeSize(fieldVarType);
+    unsigned fieldSize = genTypeSize(fieldVarType);
 
     // Do not promote if the field is not a primitive type, is floating-point,
     // or is not properly aligned.
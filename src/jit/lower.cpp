@@ -2929,6 +2929,14 @@ GenTree* Lowering::LowerCompare(GenTree* cmp)
 //
 GenTree* Lowering::LowerJTrue(GenTreeOp* jtrue)
 {
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    if (TryLowerJTrueToSelect(jtrue))
+    {
+        // The relop now feeds a SELECTCC; continue with the nodes that follow it.
+        return jtrue->gtGetOp1()->gtNext;
+    }
+#endif // _TARGET_XARCH_ || _TARGET_ARM64_
+
 #ifdef _TARGET_ARM64_
     GenTree* relop    = jtrue->gtGetOp1();
     GenTree* relopOp2 = relop->gtOp.gtGetOp2();
@@ -2974,6 +2982,360 @@ GenTree* Lowering::LowerJTrue(GenTreeOp* jtrue)
     return nullptr;
 }
 
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+//------------------------------------------------------------------------
+// IsSelectCandidateValue: Checks whether a value tree is cheap enough, and
+//    free of side effects, to be evaluated unconditionally by if-conversion.
+//
+// Arguments:
+//    range - the LIR range of the value tree
+//
+// Return Value:
+//    true if every node in the range may be speculatively evaluated.
+//
+bool Lowering::IsSelectCandidateValue(LIR::ReadOnlyRange& range)
+{
+    // Evaluating the value unconditionally costs about as much as a mispredicted
+    // branch saves only if the value is very cheap.
+    const unsigned maxNodes  = 4;
+    unsigned       nodeCount = 0;
+
+    for (GenTree* node : range)
+    {
+        if (++nodeCount > maxNodes)
+        {
+            return false;
+        }
+
+        if ((node->gtFlags & (GTF_SIDE_EFFECT | GTF_EXCEPT)) != 0)
+        {
+            return false;
+        }
+
+        switch (node->OperGet())
+        {
+            case GT_LCL_VAR:
+                if (varTypeIsStruct(node) || comp->lvaGetDesc(node->AsLclVarCommon())->lvAddrExposed)
+                {
+                    return false;
+                }
+                break;
+
+            case GT_CNS_INT:
+                break;
+
+            case GT_ADD:
+            case GT_SUB:
+            case GT_AND:
+            case GT_OR:
+            case GT_XOR:
+            case GT_NEG:
+            case GT_NOT:
+            case GT_LSH:
+            case GT_RSH:
+            case GT_RSZ:
+                if (node->gtOverflowEx() || !varTypeIsIntegralOrI(node))
+                {
+                    return false;
+                }
+                break;
+
+            case GT_CAST:
+                if (node->gtOverflow() || !varTypeIsIntegralOrI(node) ||
+                    !varTypeIsIntegralOrI(node->AsCast()->CastOp()))
+                {
+                    return false;
+                }
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// FindSelectCandidateStore: Checks whether a block consists of a single
+//    store of a cheap value to a local that if-conversion may select.
+//
+// Arguments:
+//    block - the block to check
+//
+// Return Value:
+//    The GT_STORE_LCL_VAR node if the block only contains the store, the
+//    nodes computing its value and IL offsets, nullptr otherwise.
+//
+GenTreeLclVarCommon* Lowering::FindSelectCandidateStore(BasicBlock* block)
+{
+    LIR::Range& range = LIR::AsRange(block);
+    GenTree*    store = range.LastNode();
+
+    if ((store == nullptr) || !store->OperIs(GT_STORE_LCL_VAR))
+    {
+        return nullptr;
+    }
+
+    const var_types  storeType = store->TypeGet();
+    LclVarDsc* const varDsc    = comp->lvaGetDesc(store->AsLclVarCommon());
+
+    // GC typed locals are rejected here: the select would have to report both
+    // operands as live GC values across the compare.
+    if (!varTypeIsIntegralOrI(storeType) || varTypeIsSmall(storeType) ||
+        (genTypeSize(storeType) > TARGET_POINTER_SIZE) || varDsc->lvAddrExposed ||
+        (varDsc->lvIsStructField && (comp->lvaGetParentPromotionType(varDsc) != Compiler::PROMOTION_TYPE_INDEPENDENT)))
+    {
+        return nullptr;
+    }
+
+    bool               isClosed   = false;
+    LIR::ReadOnlyRange valueRange = range.GetTreeRange(store->gtGetOp1(), &isClosed);
+
+    if (!isClosed || !IsSelectCandidateValue(valueRange))
+    {
+        return nullptr;
+    }
+
+    // Anything else in the block must be an IL offset, which can stay behind.
+    for (GenTree* node : range)
+    {
+        if ((node == store) || node->OperIs(GT_IL_OFFSET))
+        {
+            continue;
+        }
+
+        bool inValueRange = false;
+        for (GenTree* valueNode : valueRange)
+        {
+            if (valueNode == node)
+            {
+                inValueRange = true;
+                break;
+            }
+        }
+
+        if (!inValueRange)
+        {
+            return nullptr;
+        }
+    }
+
+    return store->AsLclVarCommon();
+}
+
+//------------------------------------------------------------------------
+// MoveSelectValueBefore: Moves the value of a store found by FindSelectCandidateStore
+//    out of its block, ahead of the given node in the current block, and lowers it.
+//
+// Arguments:
+//    block  - the block containing the store
+//    store  - the store; it is removed from the block as well
+//    before - the node to insert the value before
+//
+// Return Value:
+//    The value node.
+//
+GenTree* Lowering::MoveSelectValueBefore(BasicBlock* block, GenTreeLclVarCommon* store, GenTree* before)
+{
+    LIR::Range& range = LIR::AsRange(block);
+    GenTree*    value = store->gtGetOp1();
+
+    bool               isClosed   = false;
+    LIR::ReadOnlyRange valueRange = range.GetTreeRange(value, &isClosed);
+    assert(isClosed);
+
+    GenTree*   firstValueNode = valueRange.FirstNode();
+    GenTree*   lastValueNode  = valueRange.LastNode();
+    LIR::Range valueNodes     = range.Remove(std::move(valueRange));
+    range.Remove(store);
+
+    BlockRange().InsertBefore(before, std::move(valueNodes));
+    LowerRange(firstValueNode, lastValueNode);
+
+    return value;
+}
+
+//------------------------------------------------------------------------
+// TryLowerJTrueToSelect: Tries to if-convert a conditional branch that
+//    skips over, or chooses between, blocks containing a single local store.
+//
+// Arguments:
+//    jtrue - the JTRUE node ending the current block
+//
+// Return Value:
+//    true if the branch was replaced by a SELECTCC.
+//
+// Notes:
+//    Looks for the "triangle" shape
+//
+//        A: ... JTRUE(relop)  -> C
+//        B: lcl = value               (falls through to C)
+//        C: ...
+//
+//    and the "diamond" shape
+//
+//        A: ... JTRUE(relop)  -> C
+//        B: lcl = falseValue          (jumps to D)
+//        C: lcl = trueValue           (falls through or jumps to D)
+//        D: ...
+//
+//    where B and C are only reached from A, and the values are cheap and free
+//    of side effects. These are transformed to
+//
+//        A: ... value; relop (sets flags); lcl = SELECTCC(lcl, value)
+//    and
+//        A: ... falseValue; trueValue; relop (sets flags); lcl = SELECTCC(trueValue, falseValue)
+//
+//    respectively. A then falls through into the now empty B, and the diamond's
+//    C is removed. The SELECTCC is generated as a cmov on xarch and a csel on arm64.
+//
+bool Lowering::TryLowerJTrueToSelect(GenTreeOp* jtrue)
+{
+#if defined(OPT_CONFIG)
+    if (JitConfig.JitDoIfConversion() == 0)
+    {
+        return false;
+    }
+#endif // OPT_CONFIG
+
+    if (comp->opts.OptimizationDisabled() || m_block->isRunRarely())
+    {
+        return false;
+    }
+
+    GenTree* relop = jtrue->gtGetOp1();
+
+    // Only integral compares map onto a single condition code.
+    if (!relop->OperIsCompare() || (relop->gtNext != jtrue) || varTypeIsFloating(relop->gtGetOp1()))
+    {
+        return false;
+    }
+
+    BasicBlock* const block     = m_block;
+    BasicBlock* const thenBlock = block->bbNext;
+    BasicBlock* const destBlock = block->bbJumpDest;
+
+    if ((thenBlock == nullptr) || (thenBlock == destBlock) || (thenBlock->countOfInEdges() != 1) ||
+        !BasicBlock::sameEHRegion(block, thenBlock) || comp->bbIsTryBeg(thenBlock))
+    {
+        return false;
+    }
+
+    // For a diamond, the branch target is the "else" block and both arms meet at joinBlock.
+    BasicBlock* elseBlock = nullptr;
+    BasicBlock* joinBlock = destBlock;
+
+    if (thenBlock->bbJumpKind == BBJ_ALWAYS)
+    {
+        elseBlock = destBlock;
+        joinBlock = thenBlock->bbJumpDest;
+
+        if ((elseBlock != thenBlock->bbNext) || (joinBlock == elseBlock) || (elseBlock->countOfInEdges() != 1) ||
+            ((elseBlock->bbFlags & BBF_DONT_REMOVE) != 0) || !BasicBlock::sameEHRegion(block, elseBlock) ||
+            comp->bbIsTryBeg(elseBlock))
+        {
+            return false;
+        }
+
+        const bool elseFallsIntoJoin = (elseBlock->bbJumpKind == BBJ_NONE) && (elseBlock->bbNext == joinBlock);
+        const bool elseJumpsToJoin   = (elseBlock->bbJumpKind == BBJ_ALWAYS) && (elseBlock->bbJumpDest == joinBlock);
+
+        if (!elseFallsIntoJoin && !elseJumpsToJoin)
+        {
+            return false;
+        }
+    }
+    else if ((thenBlock->bbJumpKind != BBJ_NONE) || (thenBlock->bbNext != joinBlock))
+    {
+        return false;
+    }
+
+    // A well predicted branch is cheaper than the select.
+    if (block->hasProfileWeight() && thenBlock->hasProfileWeight())
+    {
+        const UINT64 thenWeight = thenBlock->bbWeight;
+        const UINT64 weight     = block->bbWeight;
+
+        if ((thenWeight * 8 < weight) || (thenWeight * 8 > weight * 7))
+        {
+            return false;
+        }
+    }
+
+    GenTreeLclVarCommon* const store = FindSelectCandidateStore(thenBlock);
+
+    if (store == nullptr)
+    {
+        return false;
+    }
+
+    GenTreeLclVarCommon* elseStore = nullptr;
+
+    if (elseBlock != nullptr)
+    {
+        elseStore = FindSelectCandidateStore(elseBlock);
+
+        if ((elseStore == nullptr) || (elseStore->GetLclNum() != store->GetLclNum()) ||
+            (elseStore->TypeGet() != store->TypeGet()))
+        {
+            return false;
+        }
+    }
+
+    const var_types storeType = store->TypeGet();
+
+    JITDUMP("If-converting %s " FMT_BB " -> " FMT_BB " into a select of V%02u\n",
+            (elseBlock != nullptr) ? "diamond" : "triangle", block->bbNum, thenBlock->bbNum, store->GetLclNum());
+
+    // Move the value computations ahead of the compare so nothing clobbers the flags
+    // between the compare and the select.
+    GenTree* falseValue = MoveSelectValueBefore(thenBlock, store, relop);
+    GenTree* trueValue;
+
+    if (elseBlock != nullptr)
+    {
+        trueValue = MoveSelectValueBefore(elseBlock, elseStore, relop);
+    }
+    else
+    {
+        // The branch was taken (skipping the store) when the relop was true, so
+        // select the old value in that case.
+        trueValue = comp->gtNewLclvNode(store->GetLclNum(), genActualType(storeType));
+        BlockRange().InsertBefore(relop, trueValue);
+    }
+
+    GenCondition condition = GenCondition::FromRelop(relop);
+    relop->gtType          = TYP_VOID;
+    relop->gtFlags |= GTF_SET_FLAGS;
+
+    GenTreeOpCC* select =
+        new (comp, GT_SELECTCC) GenTreeOpCC(GT_SELECTCC, genActualType(storeType), condition, trueValue, falseValue);
+    select->gtFlags |= GTF_USE_FLAGS;
+
+    store->gtOp1 = select;
+    BlockRange().Remove(jtrue);
+    BlockRange().InsertAfter(relop, select, store);
+
+    // Fix up the flow graph: the block now always falls into the (empty) then block.
+    comp->fgRemoveRefPred(destBlock, block);
+    block->bbJumpKind = BBJ_NONE;
+    block->bbJumpDest = nullptr;
+    thenBlock->inheritWeight(block);
+
+    if (elseBlock != nullptr)
+    {
+        // The else block is now unreachable. Removing it also turns the then
+        // block's jump into a fall through when the join block follows it.
+        comp->fgRemoveBlock(elseBlock, /* unreachable */ true);
+        comp->compCurBB = block;
+    }
+
+    return true;
+}
+
+#endif // _TARGET_XARCH_ || _TARGET_ARM64_
+
 //----------------------------------------------------------------------------------------------
 // LowerNodeCC: Lowers a node that produces a boolean value by setting the condition flags.
 //
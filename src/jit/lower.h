@@ -130,6 +130,12 @@ private:
     GenTree* OptimizeConstCompare(GenTree* cmp);
     GenTree* LowerCompare(GenTree* cmp);
     GenTree* LowerJTrue(GenTreeOp* jtrue);
+#if defined(_TARGET_XARCH_) || defined(_TARGET_ARM64_)
+    bool TryLowerJTrueToSelect(GenTreeOp* jtrue);
+    bool IsSelectCandidateValue(LIR::ReadOnlyRange& range);
+    GenTreeLclVarCommon* FindSelectCandidateStore(BasicBlock* block);
+    GenTree* MoveSelectValueBefore(BasicBlock* block, GenTreeLclVarCommon* store, GenTree* before);
+#endif // _TARGET_XARCH_ || _TARGET_ARM64_
     GenTreeCC* LowerNodeCC(GenTree* node, GenCondition condition);
     void LowerJmpMethod(GenTree* jmp);
     void LowerRet(GenTree* ret);
@@ -2973,6 +2973,18 @@ void Lowering::ContainCheckHWIntrinsic(GenTreeHWIntrinsic* node)
             assert(lastOp != nullptr);
             MakeSrcContained(node, lastOp);
         }
+        // The AVX512F intrinsics don't take memory operands, as the emitter doesn't produce
+        // the EVEX compressed displacement, but a constant IMM argument is still encoded inline
+        else if (category == HW_Category_IMM)
+        {
+            GenTree* lastOp = HWIntrinsicInfo::lookupLastOp(node);
+            assert(lastOp != nullptr);
+
+            if (HWIntrinsicInfo::isImmOp(intrinsicId, lastOp) && lastOp->IsCnsIntOrI())
+            {
+                MakeSrcContained(node, lastOp);
+            }
+        }
         // Exit early if containment isn't supported
         return;
     }
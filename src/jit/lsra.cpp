@@ -682,6 +682,7 @@ LinearScan::LinearScan(Compiler* theCompiler)
     // set won't be recomputed until after Lowering (and this constructor is called prior to Lowering),
     // so we don't want to check that yet.
     enregisterLocalVars = ((compiler->opts.compFlags & CLFLG_REGVAR) != 0);
+    localOnlyAllocation = false;
 #ifdef _TARGET_ARM64_
     availableIntRegs = (RBM_ALLINT & ~(RBM_PR | RBM_FP | RBM_LR) & ~compiler->codeGen->regSet.rsMaskResvd);
 #else
@@ -829,6 +830,14 @@ void LinearScan::setBlockSequence()
         blockInfo[block->bbNum].splitEdgeCount     = 0;
 #endif // TRACK_LSRA_STATS
 
+        // Nothing flows between blocks in registers, so there's no resolution to prepare for;
+        // simply use bbNext.
+        if (localOnlyAllocation)
+        {
+            nextBlock = block->bbNext;
+            continue;
+        }
+
         if (block->GetUniquePred(compiler) == nullptr)
         {
             for (flowList* pred = block->bbPreds; pred != nullptr; pred = pred->flNext)
@@ -1206,6 +1215,11 @@ void LinearScan::doLinearScan()
         enregisterLocalVars = false;
     }
 
+    localOnlyAllocation = !enregisterLocalVars;
+#if defined(OPT_CONFIG)
+    localOnlyAllocation = localOnlyAllocation && (JitConfig.JitLsraLocalOnly() != 0);
+#endif
+
     splitBBNumToTargetBBNumMap = nullptr;
 
     // This is complicated by the fact that physical registers have refs associated
@@ -1222,7 +1236,14 @@ void LinearScan::doLinearScan()
     DBEXEC(VERBOSE, lsraDumpIntervals("after buildIntervals"));
 
     initVarRegMaps();
-    allocateRegisters();
+    if (localOnlyAllocation)
+    {
+        allocateRegistersMinimal();
+    }
+    else
+    {
+        allocateRegisters();
+    }
     allocationPassComplete = true;
     compiler->EndPhase(PHASE_LINEAR_SCAN_ALLOC);
     resolveRegisters();
@@ -3127,6 +3148,139 @@ regNumber LinearScan::tryAllocateFreeReg(Interval* currentInterval, RefPosition*
     return foundReg;
 }
 
+//------------------------------------------------------------------------
+// allocateRegMinimal: Find a free register that satisfies the requirements for refPosition,
+//                     for use when only tree temps are being allocated
+//
+// Arguments:
+//    currentInterval: The interval for the current allocation
+//    refPosition:     The RefPosition of the current Interval for which a register is being allocated
+//
+// Return Value:
+//    The regNumber, if any, allocated to the RefPositon.  Returns REG_NA if no free register is found.
+//
+// Notes:
+//    This is the register selection used by allocateRegistersMinimal. Without any lclVars
+//    enregistered, every Interval is a tree temp, an internal register or a constant that
+//    lives for at most a few nodes, so the related-interval chains, callee-save preferencing,
+//    constant reuse and tie-breaking that tryAllocateFreeReg scores rarely change the outcome.
+//    Instead, this takes the first available register in regOrder that is in the Interval's
+//    preferences and is free for its remaining lifetime, falling back to the first preferred
+//    or available candidate.
+//    Fixed register references and defs that conflict with their use still need the full
+//    selection, as do the DEBUG stress modes that alter the candidate set.
+
+regNumber LinearScan::allocateRegMinimal(Interval* currentInterval, RefPosition* refPosition)
+{
+    assert(localOnlyAllocation && !currentInterval->isLocalVar);
+
+    bool useFullSelection = refPosition->isFixedRegRef || currentInterval->hasConflictingDefUse;
+#ifdef DEBUG
+    useFullSelection = useFullSelection || candidatesAreStressLimited();
+#endif // DEBUG
+    if (useFullSelection)
+    {
+        return tryAllocateFreeReg(currentInterval, refPosition);
+    }
+
+    RegisterType     regType = getRegisterType(currentInterval, refPosition);
+    const regNumber* regOrder;
+    unsigned         regOrderSize;
+    if (useFloatReg(regType))
+    {
+        regOrder     = lsraRegOrderFlt;
+        regOrderSize = lsraRegOrderFltSize;
+    }
+    else
+    {
+        regOrder     = lsraRegOrder;
+        regOrderSize = lsraRegOrderSize;
+    }
+
+    LsraLocation currentLocation = refPosition->nodeLocation;
+    LsraLocation lastLocation    = currentInterval->lastRefPosition->getRefEndLocation();
+    regMaskTP    candidates      = refPosition->registerAssignment;
+    regMaskTP    preferences     = currentInterval->registerPreferences & candidates;
+    assert(candidates != RBM_NONE);
+
+    enum RegisterScore
+    {
+        COVERS         = 0x2, // It is in the interval's preference set and it covers the entire lifetime.
+        OWN_PREFERENCE = 0x1, // It is in the preference set of this interval.
+    };
+
+    RegRecord* availablePhysRegRecord = nullptr;
+    bool       unassignInterval       = false;
+    int        bestScore              = -1;
+
+    for (unsigned i = 0; i < regOrderSize && (candidates != RBM_NONE); i++)
+    {
+        regNumber regNum       = regOrder[i];
+        regMaskTP candidateBit = genRegMask(regNum);
+
+        if (!(candidates & candidateBit))
+        {
+            continue;
+        }
+
+        candidates &= ~candidateBit;
+
+        RegRecord* physRegRecord = getRegisterRecord(regNum);
+
+        // This register may still hold this interval, e.g. after a copyReg.
+        if (physRegRecord->assignedInterval == currentInterval)
+        {
+            availablePhysRegRecord = physRegRecord;
+            unassignInterval       = false;
+            break;
+        }
+
+        LsraLocation nextPhysRefLocation = MaxLocation;
+        if (!registerIsAvailable(physRegRecord, currentLocation, &nextPhysRefLocation, regType) ||
+            physRegRecord->conflictingFixedRegReference(refPosition))
+        {
+            continue;
+        }
+
+        int score = 0;
+        if ((candidateBit & preferences) != RBM_NONE)
+        {
+            score |= OWN_PREFERENCE;
+            if (nextPhysRefLocation > lastLocation)
+            {
+                score |= COVERS;
+            }
+        }
+
+        if (score > bestScore)
+        {
+            availablePhysRegRecord = physRegRecord;
+            unassignInterval       = true;
+            bestScore              = score;
+
+            if (score == (COVERS | OWN_PREFERENCE))
+            {
+                break;
+            }
+        }
+    }
+
+    if (availablePhysRegRecord == nullptr)
+    {
+        return REG_NA;
+    }
+
+    if (unassignInterval && isAssigned(availablePhysRegRecord ARM_ARG(currentInterval->registerType)))
+    {
+        unassignPhysReg(availablePhysRegRecord ARM_ARG(currentInterval->registerType));
+    }
+    assignPhysReg(availablePhysRegRecord, currentInterval);
+
+    regNumber foundReg              = availablePhysRegRecord->regNum;
+    refPosition->registerAssignment = genRegMask(foundReg);
+    return foundReg;
+}
+
 //------------------------------------------------------------------------
 // canSpillReg: Determine whether we can spill physRegRecord
 //
@@ -5957,6 +6111,449 @@ void LinearScan::allocateRegisters()
 #endif // DEBUG
 }
 
+//------------------------------------------------------------------------
+// allocateRegistersMinimal: Assign registers when no lclVars are enregistered.
+//
+// Notes:
+//    This is used instead of allocateRegisters when localOnlyAllocation is set. With no
+//    register candidate lclVars there are no ParamDef, ZeroInit, DummyDef or ExpUse
+//    RefPositions, no special putargs, and nothing is live in a register across a block
+//    boundary; every Interval is a tree temp, an internal register or a constant. So this
+//    is allocateRegisters without the lclVar handling, using allocateRegMinimal to find a
+//    free register and allocateBusyReg to spill when there is none.
+//
+void LinearScan::allocateRegistersMinimal()
+{
+    assert(localOnlyAllocation && !enregisterLocalVars);
+
+    JITDUMP("*************** In LinearScan::allocateRegistersMinimal()\n");
+    DBEXEC(VERBOSE, lsraDumpIntervals("before allocateRegistersMinimal"));
+
+    for (Interval& interval : intervals)
+    {
+        assert(!interval.isLocalVar);
+        interval.recentRefPosition = nullptr;
+        interval.isActive          = false;
+    }
+
+    for (regNumber reg = REG_FIRST; reg < ACTUAL_REG_COUNT; reg = REG_NEXT(reg))
+    {
+        getRegisterRecord(reg)->recentRefPosition = nullptr;
+        getRegisterRecord(reg)->isActive          = false;
+    }
+
+#ifdef DEBUG
+    if (VERBOSE)
+    {
+        dumpRefPositions("BEFORE ALLOCATION");
+
+        printf("\n\nAllocating Registers\n"
+               "--------------------\n");
+        registersToDump = LsraLimitSmallIntSet | LsraLimitSmallFPSet;
+        dumpRegRecordHeader();
+        printf(indentFormat, "");
+    }
+#endif // DEBUG
+
+    BasicBlock* currentBlock = nullptr;
+
+    LsraLocation prevLocation    = MinLocation;
+    regMaskTP    regsToFree      = RBM_NONE;
+    regMaskTP    delayRegsToFree = RBM_NONE;
+
+    // See allocateRegisters; this is only used for the spillAlways() stress mode.
+    RefPosition* lastAllocatedRefPosition = nullptr;
+
+    for (RefPosition& refPositionIterator : refPositions)
+    {
+        RefPosition* currentRefPosition = &refPositionIterator;
+
+#ifdef DEBUG
+        activeRefPosition = nullptr;
+        if (VERBOSE)
+        {
+            dumpRegRecords();
+        }
+#endif // DEBUG
+
+        RefType        refType         = currentRefPosition->refType;
+        Referenceable* currentReferent = currentRefPosition->referent;
+        Interval*      currentInterval = nullptr;
+
+        assert((refType != RefTypeParamDef) && (refType != RefTypeZeroInit) && (refType != RefTypeDummyDef) &&
+               (refType != RefTypeExpUse));
+
+        if (spillAlways() && lastAllocatedRefPosition != nullptr && !lastAllocatedRefPosition->isPhysRegRef &&
+            !lastAllocatedRefPosition->getInterval()->isInternal && RefTypeIsDef(lastAllocatedRefPosition->refType))
+        {
+            assert(lastAllocatedRefPosition->registerAssignment != RBM_NONE);
+            RegRecord* regRecord = lastAllocatedRefPosition->getInterval()->assignedReg;
+            unassignPhysReg(regRecord, lastAllocatedRefPosition);
+            lastAllocatedRefPosition = nullptr;
+        }
+
+        // As in allocateRegisters, registers are freed once all the uses at a location are done.
+        LsraLocation currentLocation = currentRefPosition->nodeLocation;
+
+        if ((regsToFree | delayRegsToFree) != RBM_NONE)
+        {
+            if (refType == RefTypeBB)
+            {
+                assert(currentLocation > prevLocation);
+            }
+            if (currentLocation > prevLocation)
+            {
+                freeRegisters(regsToFree);
+                if ((currentLocation > (prevLocation + 1)) && (delayRegsToFree != RBM_NONE))
+                {
+                    assert(!"Found a delayRegFree associated with Location with no reference");
+                    freeRegisters(delayRegsToFree);
+                    delayRegsToFree = RBM_NONE;
+                }
+                regsToFree      = delayRegsToFree;
+                delayRegsToFree = RBM_NONE;
+            }
+        }
+        prevLocation = currentLocation;
+
+        if (currentReferent != nullptr)
+        {
+            currentReferent->recentRefPosition = currentRefPosition;
+        }
+        else
+        {
+            assert((refType == RefTypeBB) || (refType == RefTypeKillGCRefs));
+        }
+
+        INDEBUG(activeRefPosition = currentRefPosition);
+
+        if (refType == RefTypeBB)
+        {
+            // Nothing but constants can be left in registers at a block boundary.
+            freeRegisters(regsToFree);
+            regsToFree         = RBM_NONE;
+            curBBStartLocation = currentRefPosition->nodeLocation;
+            if (currentBlock == nullptr)
+            {
+                currentBlock = startBlockSequence();
+            }
+            else
+            {
+                processBlockEndAllocation(currentBlock);
+                currentBlock = moveToNextBlock();
+            }
+            INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_START_BB, nullptr, REG_NA, currentBlock));
+            continue;
+        }
+
+        if (refType == RefTypeKillGCRefs)
+        {
+            spillGCRefs(currentRefPosition);
+            continue;
+        }
+
+        // If this is a FixedReg, disassociate any inactive constant interval from this register.
+        if (refType == RefTypeFixedReg)
+        {
+            RegRecord* regRecord        = currentRefPosition->getReg();
+            Interval*  assignedInterval = regRecord->assignedInterval;
+
+            if (assignedInterval != nullptr && !assignedInterval->isActive && assignedInterval->isConstant)
+            {
+                regRecord->assignedInterval = nullptr;
+
+#ifdef _TARGET_ARM_
+                // Update overlapping floating point register for TYP_DOUBLE
+                if (assignedInterval->registerType == TYP_DOUBLE)
+                {
+                    regRecord = findAnotherHalfRegRec(regRecord);
+                    assert(regRecord->assignedInterval == assignedInterval);
+                    regRecord->assignedInterval = nullptr;
+                }
+#endif
+            }
+            INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_FIXED_REG, nullptr, currentRefPosition->assignedReg()));
+            continue;
+        }
+
+        regNumber assignedRegister = REG_NA;
+
+        if (currentRefPosition->isIntervalRef())
+        {
+            currentInterval  = currentRefPosition->getInterval();
+            assignedRegister = currentInterval->physReg;
+            assert(!currentInterval->isSpecialPutArg);
+
+#if FEATURE_PARTIAL_SIMD_CALLEE_SAVE
+            if (refType == RefTypeUpperVectorSave)
+            {
+                // Only tree temps can be live across a call here, and these are always spilled.
+                assert(!currentInterval->isUpperVector);
+                if (assignedRegister != REG_NA)
+                {
+                    unassignPhysReg(getRegisterRecord(assignedRegister), currentInterval->firstRefPosition);
+                    INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_NO_REG_ALLOCATED, currentInterval));
+                }
+                currentRefPosition->registerAssignment = RBM_NONE;
+                continue;
+            }
+#endif // FEATURE_PARTIAL_SIMD_CALLEE_SAVE
+
+            if (assignedRegister == REG_NA && RefTypeIsUse(refType))
+            {
+                currentRefPosition->reload = true;
+                INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_RELOAD, currentInterval, assignedRegister));
+            }
+        }
+
+        regMaskTP assignedRegBit = RBM_NONE;
+        if (assignedRegister != REG_NA)
+        {
+            assignedRegBit = genRegMask(assignedRegister);
+            if (!currentInterval->isActive)
+            {
+                // Only a def can find its interval inactive but still associated with a register.
+                assert(!RefTypeIsUse(refType));
+                currentInterval->isActive = true;
+            }
+            assert(currentInterval->assignedReg != nullptr &&
+                   currentInterval->assignedReg->regNum == assignedRegister &&
+                   currentInterval->assignedReg->assignedInterval == currentInterval);
+        }
+
+        // If this is a physical register, we unconditionally assign it to itself!
+        if (currentRefPosition->isPhysRegRef)
+        {
+            RegRecord* currentReg       = currentRefPosition->getReg();
+            Interval*  assignedInterval = currentReg->assignedInterval;
+
+            if (assignedInterval != nullptr)
+            {
+                unassignPhysReg(currentReg, assignedInterval->recentRefPosition);
+            }
+            currentReg->isActive = true;
+            assignedRegister     = currentReg->regNum;
+            assignedRegBit       = genRegMask(assignedRegister);
+            if (refType == RefTypeKill)
+            {
+                currentReg->isBusyUntilNextKill = false;
+            }
+        }
+
+        if (assignedRegister != REG_NA)
+        {
+            RegRecord* physRegRecord = getRegisterRecord(assignedRegister);
+
+            // If there is a conflicting fixed reference, insert a copy.
+            if (physRegRecord->conflictingFixedRegReference(currentRefPosition))
+            {
+                if (physRegRecord->assignedInterval == currentInterval)
+                {
+                    unassignPhysRegNoSpill(physRegRecord);
+                }
+                currentRefPosition->moveReg = true;
+                assignedRegister            = REG_NA;
+                setIntervalAsSplit(currentInterval);
+                INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_MOVE_REG, currentInterval, assignedRegister));
+            }
+            else if ((genRegMask(assignedRegister) & currentRefPosition->registerAssignment) != 0)
+            {
+                currentRefPosition->registerAssignment = assignedRegBit;
+                if (!currentReferent->isActive)
+                {
+                    currentRefPosition->reload = true;
+                }
+                INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_KEPT_ALLOCATION, currentInterval, assignedRegister));
+            }
+            else
+            {
+                assert(currentInterval != nullptr);
+
+                // It's already in a register, but not one we need.
+                if (!RefTypeIsDef(currentRefPosition->refType))
+                {
+                    regNumber copyReg = assignCopyReg(currentRefPosition);
+                    assert(copyReg != REG_NA);
+                    INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_COPY_REG, currentInterval, copyReg));
+                    lastAllocatedRefPosition = currentRefPosition;
+                    if (currentRefPosition->lastUse)
+                    {
+                        if (currentRefPosition->delayRegFree)
+                        {
+                            INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_LAST_USE_DELAYED, currentInterval,
+                                                            assignedRegister));
+                            delayRegsToFree |= (genRegMask(assignedRegister) | currentRefPosition->registerAssignment);
+                        }
+                        else
+                        {
+                            INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_LAST_USE, currentInterval, assignedRegister));
+                            regsToFree |= (genRegMask(assignedRegister) | currentRefPosition->registerAssignment);
+                        }
+                    }
+                    // A tree temp needs an explicit move.
+                    currentRefPosition->moveReg = true;
+                    currentRefPosition->copyReg = false;
+                    continue;
+                }
+                else
+                {
+                    INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_NEEDS_NEW_REG, nullptr, assignedRegister));
+                    regsToFree |= genRegMask(assignedRegister);
+                    // We want a new register, but we don't want this to be considered a spill.
+                    assignedRegister = REG_NA;
+                    if (physRegRecord->assignedInterval == currentInterval)
+                    {
+                        unassignPhysRegNoSpill(physRegRecord);
+                    }
+                }
+            }
+        }
+
+        if (assignedRegister == REG_NA)
+        {
+            bool allocateReg = true;
+
+            if (currentRefPosition->RegOptional())
+            {
+                // We can avoid allocating a register if it is a the last use requiring a reload.
+                if (currentRefPosition->lastUse && currentRefPosition->reload)
+                {
+                    allocateReg = false;
+                }
+
+#ifdef DEBUG
+                // Under stress mode, don't allocate registers to RegOptional RefPositions.
+                if (allocateReg && regOptionalNoAlloc())
+                {
+                    allocateReg = false;
+                }
+#endif
+            }
+
+            if (allocateReg)
+            {
+                assignedRegister = allocateRegMinimal(currentInterval, currentRefPosition);
+            }
+
+            // If no register was found, and if the currentRefPosition must have a register,
+            // then find a register to spill
+            if (assignedRegister == REG_NA)
+            {
+                if (currentRefPosition->IsActualRef())
+                {
+                    if (allocateReg)
+                    {
+                        assignedRegister =
+                            allocateBusyReg(currentInterval, currentRefPosition, currentRefPosition->RegOptional());
+                    }
+
+                    if (assignedRegister != REG_NA)
+                    {
+                        INDEBUG(
+                            dumpLsraAllocationEvent(LSRA_EVENT_ALLOC_SPILLED_REG, currentInterval, assignedRegister));
+                    }
+                    else
+                    {
+                        // This can happen only for those ref positions that are to be allocated
+                        // only if profitable.
+                        noway_assert(currentRefPosition->RegOptional());
+
+                        currentRefPosition->registerAssignment = RBM_NONE;
+                        currentRefPosition->reload             = false;
+                        setIntervalAsSpilled(currentInterval);
+
+                        INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_NO_REG_ALLOCATED, currentInterval));
+                    }
+                }
+                else
+                {
+                    INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_NO_REG_ALLOCATED, currentInterval));
+                    currentRefPosition->registerAssignment = RBM_NONE;
+                    currentInterval->isActive              = false;
+                    setIntervalAsSpilled(currentInterval);
+                }
+            }
+#ifdef DEBUG
+            else
+            {
+                dumpLsraAllocationEvent(LSRA_EVENT_ALLOC_REG, currentInterval, assignedRegister, currentBlock);
+            }
+#endif // DEBUG
+        }
+
+        // If we allocated a register, record it
+        if (currentInterval != nullptr && assignedRegister != REG_NA)
+        {
+            assignedRegBit                         = genRegMask(assignedRegister);
+            currentRefPosition->registerAssignment = assignedRegBit;
+            currentInterval->physReg               = assignedRegister;
+            regsToFree &= ~assignedRegBit; // we'll set it again later if it's dead
+
+            // If this interval is dead, free the register.
+            if (currentRefPosition->lastUse || currentRefPosition->nextRefPosition == nullptr)
+            {
+                if (currentRefPosition->nextRefPosition == nullptr)
+                {
+                    if (currentRefPosition->delayRegFree)
+                    {
+                        delayRegsToFree |= assignedRegBit;
+                        INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_LAST_USE_DELAYED));
+                    }
+                    else
+                    {
+                        regsToFree |= assignedRegBit;
+                        INDEBUG(dumpLsraAllocationEvent(LSRA_EVENT_LAST_USE));
+                    }
+                }
+                else
+                {
+                    currentInterval->isActive = false;
+                }
+
+                // Update the register preferences for the relatedInterval, if this is 'preferencedToDef'.
+                if (currentInterval->relatedInterval != nullptr)
+                {
+                    currentInterval->relatedInterval->updateRegisterPreferences(assignedRegBit);
+                }
+            }
+
+            lastAllocatedRefPosition = currentRefPosition;
+        }
+    }
+
+    // Free registers to clear associated intervals for resolution phase
+    CLANG_FORMAT_COMMENT_ANCHOR;
+
+#ifdef DEBUG
+    if (getLsraExtendLifeTimes())
+    {
+        for (int regNumIndex = 0; regNumIndex <= REG_FP_LAST; regNumIndex++)
+        {
+            RegRecord& regRecord = physRegs[regNumIndex];
+            Interval*  interval  = regRecord.assignedInterval;
+            if (interval != nullptr)
+            {
+                interval->isActive = false;
+                unassignPhysReg(&regRecord, nullptr);
+            }
+        }
+    }
+    else
+#endif // DEBUG
+    {
+        freeRegisters(regsToFree | delayRegsToFree);
+    }
+
+#ifdef DEBUG
+    if (VERBOSE)
+    {
+        dumpRegRecords();
+        printf("\n");
+        dumpRefPositions("AFTER ALLOCATION");
+    }
+#endif // DEBUG
+}
+
 //-----------------------------------------------------------------------------
 // updateAssignedInterval: Update assigned interval of register.
 //
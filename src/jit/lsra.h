@@ -642,6 +642,7 @@ public:
 
     // This is where the actual assignment is done
     void allocateRegisters();
+    void allocateRegistersMinimal();
 
     // This is the resolution phase, where cross-block mismatches are fixed up
     void resolveRegisters();
@@ -1153,6 +1154,7 @@ private:
      ****************************************************************************/
     RegisterType getRegisterType(Interval* currentInterval, RefPosition* refPosition);
     regNumber tryAllocateFreeReg(Interval* current, RefPosition* refPosition);
+    regNumber allocateRegMinimal(Interval* current, RefPosition* refPosition);
     regNumber allocateBusyReg(Interval* current, RefPosition* refPosition, bool allocateIfProfitable);
     regNumber assignCopyReg(RefPosition* refPosition);
 
@@ -1431,6 +1433,13 @@ private:
     // True if there are any register candidate lclVars available for allocation.
     bool enregisterLocalVars;
 
+    // True if allocation is purely local to each block. This is the case when no lclVars are
+    // enregistered (e.g. under MinOpts), so nothing is live in a register across a block
+    // boundary: blocks are allocated in layout order, the bookkeeping that only serves
+    // resolution (critical edges, predecessor selection) is skipped, and registers are
+    // assigned by allocateRegistersMinimal.
+    bool localOnlyAllocation;
+
     virtual bool willEnregisterLocalVars() const
     {
         return enregisterLocalVars;
@@ -221,6 +221,12 @@ int LinearScan::BuildNode(GenTree* tree)
             assert(dstCount == 0);
             break;
 
+        case GT_SELECTCC:
+            srcCount = BuildBinaryUses(tree->AsOp());
+            assert(dstCount == 1);
+            BuildDef(tree);
+            break;
+
         case GT_JMP:
             srcCount = 0;
             assert(dstCount == 0);
@@ -4713,12 +4713,25 @@ GenTree* Compiler::fgMorphMultiregStructArg(GenTree* arg, fgArgTabEntry* fgEntry
                 var_types loType = loVarDsc->lvType;
                 var_types hiType = hiVarDsc->lvType;
 
-                if (varTypeIsFloating(loType) || varTypeIsFloating(hiType))
+#ifdef UNIX_AMD64_ABI
+                // On SysV each eightbyte is passed in a register of the class it was classified as, so
+                // floating point fields can be passed directly as long as they line up with SSE eightbytes.
+                bool fieldsMatchArgRegs =
+                    (varTypeIsFloating(loType) == varTypeIsFloating(type[0])) &&
+                    (varTypeIsFloating(hiType) == varTypeIsFloating(type[1])) &&
+                    (!varTypeIsFloating(loType) || (loType == type[0])) &&
+                    (!varTypeIsFloating(hiType) || (hiType == type[1]));
+#else  // !UNIX_AMD64_ABI
+                bool fieldsMatchArgRegs = !varTypeIsFloating(loType) && !varTypeIsFloating(hiType);
+#endif // !UNIX_AMD64_ABI
+
+                if (!fieldsMatchArgRegs)
                 {
                     // TODO-LSRA - It currently doesn't support the passing of floating point LCL_VARS in the integer
                     // registers. So for now we will use GT_LCLFLD's to pass this struct (it won't be enregistered)
                     //
-                    JITDUMP("Multireg struct V%02u will be passed using GT_LCLFLD because it has float fields.\n",
+                    JITDUMP("Multireg struct V%02u will be passed using GT_LCLFLD because its float fields do not "
+                            "match the arg registers.\n",
                             varNum);
                     //
                     // we call lvaSetVarDoNotEnregister and do the proper transformation below.
@@ -17186,21 +17199,50 @@ void Compiler::fgMorphStructField(GenTree* tree, GenTree* parent)
             // mismatch like this, don't do this morphing. The local var may end up getting marked as
             // address taken, and the appropriate SHORT load will be done from memory in that case.
 
-            if (tree->TypeGet() == obj->TypeGet())
+            //
+            // The local may also be a promoted struct field that struct promotion retyped as the scalar
+            // wrapped by a chain of single field structs (see TryPromoteStructField). Once the outermost
+            // wrapper access has been replaced with the field local, the accesses of the nested wrappers
+            // are struct typed FIELDs at offset 0 of that scalar local. These are folded onto the local
+            // as well, otherwise the wrapper fields would be accessed through the address of the local.
+
+            bool isNestedWrapper = false;
+
+            if ((tree->TypeGet() == TYP_STRUCT) && varDsc->lvIsStructField && (field->gtFldOffset == 0))
+            {
+                CORINFO_CLASS_HANDLE fieldClass = nullptr;
+                info.compCompHnd->getFieldType(field->gtFldHnd, &fieldClass);
+
+                isNestedWrapper = (fieldClass != NO_CLASS_HANDLE) &&
+                                  (info.compCompHnd->getClassSize(fieldClass) == genTypeSize(obj->TypeGet()));
+            }
+
+            if ((tree->TypeGet() == obj->TypeGet()) || isNestedWrapper)
             {
                 tree->ChangeOper(GT_LCL_VAR);
                 tree->gtLclVarCommon.SetLclNum(lclNum);
+                tree->gtType = obj->TypeGet();
                 tree->gtFlags &= GTF_NODE_MASK;
 
-                if ((parent->gtOper == GT_ASG) && (parent->gtOp.gtOp1 == tree))
+                if (parent->gtOper == GT_ASG)
                 {
-                    tree->gtFlags |= GTF_VAR_DEF;
-                    tree->gtFlags |= GTF_DONT_CSE;
+                    if (parent->gtOp.gtOp1 == tree)
+                    {
+                        tree->gtFlags |= GTF_VAR_DEF;
+                        tree->gtFlags |= GTF_DONT_CSE;
+                    }
+
+                    // As for the promoted case above, a struct assignment may now have a scalar RHS.
+                    if (isNestedWrapper && varTypeIsStruct(parent) && (parent->gtOp.gtOp2 == tree))
+                    {
+                        tree->gtFlags |= GTF_DONT_CSE;
+                    }
                 }
 #ifdef DEBUG
                 if (verbose)
                 {
-                    printf("Replacing the field in normed struct with local var V%02u\n", lclNum);
+                    printf("Replacing the field in %s with local var V%02u\n",
+                           isNestedWrapper ? "nested struct wrapper" : "normed struct", lclNum);
                 }
 #endif // DEBUG
             }
@@ -18120,6 +18162,19 @@ public:
                     }
 
                     PopValue();
+
+                    // The object may have been a nested struct wrapper field that was replaced with a
+                    // promoted field local only after this node was visited in PreOrderVisit, give the
+                    // field another chance to be replaced as well.
+                    if (TopValue(0).IsLocation() && m_compiler->lvaGetDesc(TopValue(0).LclNum())->lvIsStructField)
+                    {
+                        GenTree* obj = node->AsField()->gtFldObj;
+
+                        if (obj->OperIs(GT_ADDR) && obj->gtGetOp1()->OperIs(GT_LCL_VAR))
+                        {
+                            MorphStructField(node, user);
+                        }
+                    }
                 }
                 else
                 {
@@ -387,9 +387,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 unsigned int         lclNum     = op1->AsLclVar()->GetLclNum();
                 CORINFO_CLASS_HANDLE clsHnd     = op2->AsAllocObj()->gtAllocObjClsHnd;
 
-                // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
-                if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump &&
-                    CanAllocateLclVarOnStack(lclNum, clsHnd))
+                // Allocations inside basic blocks that may be in a loop can only be done on the stack
+                // if no other local may refer to an object allocated in a previous iteration.
+                if (IsObjectStackAllocationEnabled() && CanAllocateLclVarOnStack(lclNum, clsHnd) &&
+                    (!basicBlockHasBackwardJump || CanAllocateLclVarOnStackInLoop(lclNum, block, stmt)))
                 {
                     JITDUMP("Allocating local variable V%02u on the stack\n", lclNum);
 
@@ -432,6 +433,156 @@ bool ObjectAllocator::MorphAllocObjNodes()
     return didStackAllocate;
 }
 
+//------------------------------------------------------------------------
+// CanAllocateLclVarOnStackInLoop: Check whether an allocation assigned to the
+//                                 local variable can be done on the stack when
+//                                 the allocation site may be in a loop.
+//
+// Arguments:
+//    lclNum   - Local variable number
+//    block    - Block containing the allocation
+//    stmt     - Statement containing the allocation
+//
+// Return Value:
+//    true if the allocation can be done on the stack; false otherwise.
+//
+// Notes:
+//    Each iteration of the loop reuses (and re-initializes) the same stack
+//    memory, so this is only safe if the object allocated in one iteration
+//    can't be observed once the next iteration's allocation is made.
+//
+//    The allocation temp itself is overwritten by the allocation. Any other
+//    local that may point to the object must be overwritten in the same
+//    block, after the allocation and before any use of it, so that it can't
+//    carry a reference to the previous iteration's object past the point
+//    where the memory is re-initialized. This covers the copy of the newobj
+//    temp into the user local that the importer creates (`loc = tmp`).
+
+bool ObjectAllocator::CanAllocateLclVarOnStackInLoop(unsigned int lclNum, BasicBlock* block, Statement* stmt)
+{
+    assert(m_AnalysisDone);
+
+    if (comp->lvaTable[lclNum].lvSingleDef == 0)
+    {
+        return false;
+    }
+
+    // Find all the locals that may point to the objects lclNum points to.
+    BitVec aliases   = BitVecOps::MakeSingleton(&m_bitVecTraits, lclNum);
+    bool   addedMore = true;
+
+    const unsigned int lclCount = BitVecTraits::GetSize(&m_bitVecTraits);
+
+    while (addedMore)
+    {
+        addedMore = false;
+
+        for (unsigned int otherLclNum = 0; otherLclNum < lclCount; ++otherLclNum)
+        {
+            if ((m_ConnGraphAdjacencyMatrix[otherLclNum] == nullptr) ||
+                BitVecOps::IsMember(&m_bitVecTraits, aliases, otherLclNum))
+            {
+                continue;
+            }
+
+            if (!BitVecOps::IsEmptyIntersection(&m_bitVecTraits, m_ConnGraphAdjacencyMatrix[otherLclNum], aliases))
+            {
+                BitVecOps::AddElemD(&m_bitVecTraits, aliases, otherLclNum);
+                addedMore = true;
+            }
+        }
+    }
+
+    BitVecOps::RemoveElemD(&m_bitVecTraits, aliases, lclNum);
+
+    if (BitVecOps::IsEmpty(&m_bitVecTraits, aliases))
+    {
+        return true;
+    }
+
+    // A handler could observe an alias before it is overwritten.
+    if (block->hasTryIndex())
+    {
+        JITDUMP("V%02u has aliases and the allocation is in a try region\n", lclNum);
+        return false;
+    }
+
+    class FindAliasUseVisitor final : public GenTreeVisitor<FindAliasUseVisitor>
+    {
+        BitVecTraits* m_traits;
+        BitVec        m_aliases;
+        GenTree*      m_defNode;
+
+    public:
+        enum
+        {
+            DoPreOrder    = true,
+            DoLclVarsOnly = true,
+        };
+
+        unsigned int m_useNum;
+
+        FindAliasUseVisitor(Compiler* comp, BitVecTraits* traits, BitVec aliases, GenTree* defNode)
+            : GenTreeVisitor<FindAliasUseVisitor>(comp)
+            , m_traits(traits)
+            , m_aliases(aliases)
+            , m_defNode(defNode)
+            , m_useNum(BAD_VAR_NUM)
+        {
+        }
+
+        Compiler::fgWalkResult PreOrderVisit(GenTree** use, GenTree* user)
+        {
+            GenTree* const tree = *use;
+
+            if ((tree != m_defNode) && BitVecOps::IsMember(m_traits, m_aliases, tree->AsLclVarCommon()->GetLclNum()))
+            {
+                m_useNum = tree->AsLclVarCommon()->GetLclNum();
+                return Compiler::fgWalkResult::WALK_ABORT;
+            }
+
+            return Compiler::fgWalkResult::WALK_CONTINUE;
+        }
+    };
+
+    for (Statement* nextStmt = stmt->GetNextStmt(); nextStmt != nullptr; nextStmt = nextStmt->GetNextStmt())
+    {
+        GenTree* const expr    = nextStmt->gtStmtExpr;
+        GenTree*       defNode = nullptr;
+        unsigned int   defNum  = BAD_VAR_NUM;
+
+        if (expr->OperIs(GT_ASG) && expr->gtGetOp1()->OperIs(GT_LCL_VAR))
+        {
+            defNode = expr->gtGetOp1();
+            defNum  = defNode->AsLclVarCommon()->GetLclNum();
+        }
+
+        FindAliasUseVisitor findAliasUseVisitor(comp, &m_bitVecTraits, aliases, defNode);
+        findAliasUseVisitor.WalkTree(&nextStmt->gtStmtExpr, nullptr);
+
+        if (findAliasUseVisitor.m_useNum != BAD_VAR_NUM)
+        {
+            JITDUMP("V%02u may be referenced by V%02u across loop iterations\n", lclNum,
+                    findAliasUseVisitor.m_useNum);
+            return false;
+        }
+
+        if ((defNum != BAD_VAR_NUM) && BitVecOps::IsMember(&m_bitVecTraits, aliases, defNum))
+        {
+            BitVecOps::RemoveElemD(&m_bitVecTraits, aliases, defNum);
+
+            if (BitVecOps::IsEmpty(&m_bitVecTraits, aliases))
+            {
+                return true;
+            }
+        }
+    }
+
+    JITDUMP("V%02u may be referenced across loop iterations by locals not redefined in " FMT_BB "\n", lclNum,
+            block->bbNum);
+    return false;
+}
+
 //------------------------------------------------------------------------
 // MorphAllocObjNodeIntoHelperCall: Morph a GT_ALLOCOBJ node into an
 //                                  allocation helper call.
@@ -639,6 +790,7 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
                 canLclVarEscapeViaParentStack = false;
                 break;
 
@@ -747,6 +899,7 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
 
             case GT_EQ:
             case GT_NE:
+            case GT_NULLCHECK:
                 break;
 
             case GT_COMMA:
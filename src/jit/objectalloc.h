@@ -49,6 +49,7 @@ protected:
 
 private:
     bool CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool CanAllocateLclVarOnStackInLoop(unsigned int lclNum, BasicBlock* block, Statement* stmt);
     bool CanLclVarEscape(unsigned int lclNum);
     void MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -122,7 +123,9 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 //    Returns true iff local variable can be allocated on the stack.
 //
 // Notes:
-//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+//    Stack allocation of boxed objects is currently disabled. Objects with gc fields
+//    are allocated as struct locals with a gc layout, so their fields are reported
+//    as untracked gc slots.
 
 inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
 {
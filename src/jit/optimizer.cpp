@@ -39,6 +39,7 @@ void Compiler::optInit()
     optCSEstart          = UINT_MAX;
     optCSEcount          = 0;
 #endif // FEATURE_ANYCSE
+    optReachableBitVecTraits = nullptr;
 }
 
 DataFlow::DataFlow(Compiler* pCompiler) : m_pCompiler(pCompiler)
@@ -3901,6 +3902,17 @@ void Compiler::optUnrollLoops()
     DONE_LOOP:;
     }
 
+    bool doPartialUnroll = true;
+
+#if defined(OPT_CONFIG)
+    doPartialUnroll = (JitConfig.JitDoPartialUnrollLoops() != 0);
+#endif // OPT_CONFIG
+
+    if (doPartialUnroll)
+    {
+        change |= optPartiallyUnrollLoops();
+    }
+
     if (change)
     {
         fgUpdateChangedFlowGraph();
@@ -3914,6 +3926,180 @@ void Compiler::optUnrollLoops()
 #pragma warning(pop)
 #endif
 
+//------------------------------------------------------------------------
+// optPartiallyUnrollLoops: Unroll small single-block counted loops whose
+//    trip count is not known at compile time.
+//
+// Returns:
+//    true if any loop was unrolled; the caller is responsible for updating
+//    the flow graph.
+//
+// Notes:
+//    A single-block do-while loop
+//
+//      BB01: body; i += c; if (i < n) goto BB01
+//
+//    is rewritten as
+//
+//      BB01: body; i += c; if (!(i < n)) goto EXIT
+//      BB02: body; i += c; if (i < n) goto BB01
+//
+//    Every copy keeps its exit test so no remainder loop is needed. The win
+//    comes from halving the number of taken back edges and from giving the
+//    later phases a longer straight-line body to work with.
+//
+//    The loop is no longer an LPFLG_ITER loop after this transformation since
+//    the iterator is updated more than once per trip around the back edge.
+
+bool Compiler::optPartiallyUnrollLoops()
+{
+    const unsigned unrollFactor = 2;
+
+    static const unsigned PARTIAL_UNROLL_LIMIT_SZ[COUNT_OPT_CODE + 1] = {
+        30, // BLENDED_CODE
+        0,  // SMALL_CODE
+        60, // FAST_CODE
+        0   // COUNT_OPT_CODE
+    };
+
+    noway_assert(PARTIAL_UNROLL_LIMIT_SZ[SMALL_CODE] == 0);
+    noway_assert(PARTIAL_UNROLL_LIMIT_SZ[COUNT_OPT_CODE] == 0);
+
+    const unsigned unrollLimitSz = PARTIAL_UNROLL_LIMIT_SZ[compCodeOpt()];
+    bool           change        = false;
+
+    for (unsigned lnum = 0; lnum < optLoopCount; lnum++)
+    {
+        LoopDsc& loop = optLoopTable[lnum];
+
+        const unsigned requiredFlags = LPFLG_DO_WHILE | LPFLG_ITER;
+
+        if (((loop.lpFlags & requiredFlags) != requiredFlags) ||
+            ((loop.lpFlags & (LPFLG_DONT_UNROLL | LPFLG_REMOVED)) != 0))
+        {
+            continue;
+        }
+
+        BasicBlock* bottom = loop.lpBottom;
+        BasicBlock* exit   = bottom->bbNext;
+
+        // Only handle loops that consist of a single block branching back to itself.
+        if ((loop.lpHead->bbNext != bottom) || (loop.lpTop != bottom) || (loop.lpEntry != bottom) ||
+            (bottom->bbJumpKind != BBJ_COND) || (bottom->bbJumpDest != bottom) || (exit == nullptr))
+        {
+            continue;
+        }
+
+        // The new exits must not leave an enclosing loop, otherwise that loop's exit
+        // information would need to be updated as well.
+        bool exitsParentLoop = false;
+        for (unsigned parent = loop.lpParent; parent != BasicBlock::NOT_IN_LOOP; parent = optLoopTable[parent].lpParent)
+        {
+            if (!optLoopTable[parent].lpContains(exit))
+            {
+                exitsParentLoop = true;
+                break;
+            }
+        }
+
+        if (exitsParentLoop)
+        {
+            continue;
+        }
+
+        unsigned loopCostSz = 0;
+        for (Statement* stmt : bottom->Statements())
+        {
+            gtSetStmtInfo(stmt);
+            loopCostSz += stmt->GetCostSz();
+        }
+
+        if (loopCostSz > unrollLimitSz)
+        {
+            continue;
+        }
+
+        // cloneExpr doesn't handle everything. Find out before adding any block to the
+        // flow graph, so that giving up doesn't leave partial copies behind.
+        bool canClone = true;
+        for (Statement* stmt : bottom->Statements())
+        {
+            if (gtCloneExpr(stmt->gtStmtExpr) == nullptr)
+            {
+                canClone = false;
+                break;
+            }
+        }
+
+        if (!canClone)
+        {
+            loop.lpFlags |= LPFLG_DONT_UNROLL;
+            continue;
+        }
+
+        // Create the copies of the loop body. All the copies are made before the
+        // original test is reversed so they start out with the original sense.
+        BasicBlock* insertAfter = bottom;
+
+        for (unsigned i = 1; i < unrollFactor; i++)
+        {
+            BasicBlock* newBlock = insertAfter = fgNewBBafter(BBJ_COND, insertAfter, /*extendRegion*/ true);
+
+            bool cloned = BasicBlock::CloneBlockState(this, newBlock, bottom);
+            noway_assert(cloned);
+
+            newBlock->bbFlags &= ~BBF_LOOP_HEAD;
+            newBlock->bbJumpDest = exit;
+        }
+
+        JITDUMP("\nPartially unrolling loop " FMT_BB " by %u, loopCostSz = %u\n", bottom->bbNum, unrollFactor,
+                loopCostSz);
+
+        // Every copy but the last one exits the loop when the original test fails;
+        // the last copy branches back to the top when it succeeds.
+        for (BasicBlock* block = bottom; block != insertAfter; block = block->bbNext)
+        {
+            GenTree* test = block->lastStmt()->gtStmtExpr;
+            noway_assert(test->OperIs(GT_JTRUE));
+
+            test->gtOp.gtOp1 = gtReverseCond(test->gtOp.gtOp1);
+            block->bbJumpDest = exit;
+        }
+
+        insertAfter->bbJumpDest = bottom;
+
+        // Each copy runs once for every unrollFactor iterations of the original loop, so split the
+        // original weight between them to keep the per-iteration weights the same.
+        const unsigned copyPercentage = 100 / unrollFactor;
+
+        for (BasicBlock* block = bottom->bbNext; block != insertAfter->bbNext; block = block->bbNext)
+        {
+            block->inheritWeightPercentage(bottom, copyPercentage);
+        }
+
+        bottom->inheritWeightPercentage(bottom, copyPercentage);
+
+        loop.lpBottom = insertAfter;
+        loop.lpExit   = nullptr;
+        loop.lpExitCnt += (unrollFactor - 1);
+        loop.lpFlags &= ~(LPFLG_ONE_EXIT | LPFLG_ITER | LPFLG_CONST | LPFLG_VAR_INIT | LPFLG_CONST_INIT |
+                          LPFLG_VAR_LIMIT | LPFLG_CONST_LIMIT | LPFLG_ARRLEN_LIMIT | LPFLG_SIMD_LIMIT);
+        loop.lpFlags |= LPFLG_DONT_UNROLL;
+
+#ifdef DEBUG
+        if (verbose)
+        {
+            printf("Partially unrolled loop:\n");
+            fgDumpTrees(bottom, insertAfter);
+        }
+#endif
+
+        change = true;
+    }
+
+    return change;
+}
+
 /*****************************************************************************
  *
  *  Return false if there is a code path from 'topBB' to 'botBB' that might
@@ -4530,10 +4716,11 @@ void Compiler::optOptimizeLoops()
 // Operation:
 //     Inspect the loop cloning optimization candidates and populate the conditions necessary
 //     for each optimization candidate. Checks if the loop stride is "> 0" if the loop
-//     condition is "less than". If the initializer is "var" init then adds condition
-//     "var >= 0", and if the loop is var limit then, "var >= 0" and "var <= a.len"
-//     are added to "context". These conditions are checked in the pre-header block
-//     and the cloning choice is made.
+//     condition is "less than" or "less than or equal". If the initializer is "var" init
+//     then adds condition "var >= 0", and if the loop is var limit then, "var >= 0" and
+//     "var <= a.len" ("var < a.len" for a "less than or equal" loop condition) are added
+//     to "context". These conditions are checked in the pre-header block and the cloning
+//     choice is made.
 //
 // Assumption:
 //      Callers should assume AND operation is used i.e., if all conditions are
@@ -4547,8 +4734,12 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
     LoopDsc*                         loop     = &optLoopTable[loopNum];
     JitExpandArrayStack<LcOptInfo*>* optInfos = context->GetLoopOptInfo(loopNum);
 
-    if (loop->lpTestOper() == GT_LT)
+    if ((loop->lpTestOper() == GT_LT) || (loop->lpTestOper() == GT_LE))
     {
+        // For "i < limit" the limit may be equal to the array length; for "i <= limit"
+        // the limit itself is used as an index so it must be strictly less.
+        const genTreeOps limitOper = (loop->lpTestOper() == GT_LT) ? GT_LE : GT_LT;
+
         // Stride conditions
         if (loop->lpIterConst() <= 0)
         {
@@ -4627,12 +4818,12 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             {
                 case LcOptInfo::LcJaggedArray:
                 {
-                    // limit <= arrLen
+                    // limit <= arrLen (or limit < arrLen)
                     LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
                     LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
                     LC_Ident arrLenIdent = LC_Ident(arrLen);
 
-                    LC_Condition cond(GT_LE, LC_Expr(ident), LC_Expr(arrLenIdent));
+                    LC_Condition cond(limitOper, LC_Expr(ident), LC_Expr(arrLenIdent));
                     context->EnsureConditions(loopNum)->Push(cond);
 
                     // Ensure that this array must be dereference-able, before executing the actual condition.
@@ -4642,9 +4833,9 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
                 break;
                 case LcOptInfo::LcMdArray:
                 {
-                    // limit <= mdArrLen
+                    // limit <= mdArrLen (or limit < mdArrLen)
                     LcMdArrayOptInfo* mdArrInfo = optInfo->AsLcMdArrayOptInfo();
-                    LC_Condition      cond(GT_LE, LC_Expr(ident),
+                    LC_Condition      cond(limitOper, LC_Expr(ident),
                                       LC_Expr(LC_Ident(LC_Array(LC_Array::MdArray,
                                                                 mdArrInfo->GetArrIndexForDim(getAllocator()),
                                                                 mdArrInfo->dim, LC_Array::None))));
@@ -6779,6 +6970,9 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
         bool              m_beforeSideEffect;
         unsigned          m_loopNum;
         LoopHoistContext* m_hoistContext;
+        // The union of the exception sets of the trees that are evaluated, in every iteration,
+        // before the first possible global side effect.
+        ValueNum m_checkedExcSet;
 
         bool IsNodeHoistable(GenTree* node)
         {
@@ -6799,6 +6993,45 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
                                                     &m_hoistContext->m_curLoopVnInvariantCache);
         }
 
+        //------------------------------------------------------------------------
+        // IsTreeExcSetChecked: Check if all the exceptions a tree may raise would have
+        //    already been raised by trees evaluated before the first global side effect.
+        //
+        // Arguments:
+        //    tree - The tree to check
+        //
+        // Return Value:
+        //    true if the tree's exceptions are a subset of the "checked" exception set.
+        //
+        // Notes:
+        //    This allows hoisting things like "this._buffer" or "a.Length" past an in-loop
+        //    store when the same null (or bounds) check already happens earlier in the
+        //    loop: if the hoisted tree throws, the loop would have thrown the very same
+        //    exception before performing any side effect.
+        //
+        //    Trees containing calls are not considered, the exception sets of helper
+        //    calls aren't always modeled by value numbering.
+        //
+        bool IsTreeExcSetChecked(GenTree* tree)
+        {
+            if ((tree->gtFlags & GTF_CALL) != 0)
+            {
+                return false;
+            }
+
+            ValueNum treeVN = tree->gtVNPair.GetLiberal();
+
+            if (treeVN == ValueNumStore::NoVN)
+            {
+                return false;
+            }
+
+            ValueNumStore* vnStore = m_compiler->vnStore;
+            ValueNum       excSet  = vnStore->VNExceptionSet(treeVN);
+
+            return (excSet != ValueNumStore::VNForEmptyExcSet()) && vnStore->VNExcIsSubset(m_checkedExcSet, excSet);
+        }
+
     public:
         enum
         {
@@ -6815,6 +7048,7 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
             , m_beforeSideEffect(true)
             , m_loopNum(loopNum)
             , m_hoistContext(hoistContext)
+            , m_checkedExcSet(ValueNumStore::VNForEmptyExcSet())
         {
         }
 
@@ -6987,10 +7221,10 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
                     {
                         // For now, we give up on an expression that might raise an exception if it is after the
                         // first possible global side effect (and we assume we're after that if we're not in the first
-                        // block).
+                        // block), unless the same exceptions are already raised before that side effect.
                         // TODO-CQ: this is when we might do loop cloning.
                         //
-                        if ((tree->gtFlags & GTF_EXCEPT) != 0)
+                        if (((tree->gtFlags & GTF_EXCEPT) != 0) && !IsTreeExcSetChecked(tree))
                         {
                             treeIsHoistable = false;
                         }
@@ -7015,6 +7249,16 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
             //
             if (m_beforeSideEffect)
             {
+                // A tree raises its exceptions before it has any side effect of its own, so record
+                // them first. The exception sets of the children are included in the tree's set.
+                if (((tree->gtFlags & GTF_EXCEPT) != 0) && ((tree->gtFlags & GTF_CALL) == 0) &&
+                    tree->OperMayThrow(m_compiler) && (tree->gtVNPair.GetLiberal() != ValueNumStore::NoVN))
+                {
+                    ValueNumStore* vnStore = m_compiler->vnStore;
+                    m_checkedExcSet =
+                        vnStore->VNExcSetUnion(m_checkedExcSet, vnStore->VNExceptionSet(tree->gtVNPair.GetLiberal()));
+                }
+
                 // For this purpose, we only care about memory side effects.  We assume that expressions will
                 // be hoisted so that they are evaluated in the same order as they would have been in the loop,
                 // and therefore throw exceptions in the same order.  (So we don't use GTF_GLOBALLY_VISIBLE_SIDE_EFFECTS
@@ -8115,12 +8359,23 @@ bool Compiler::optIdentifyLoopOptInfo(unsigned loopNum, LoopCloneContext* contex
     }
 
     // TODO-CQ: CLONE: Mark increasing or decreasing loops.
-    if ((pLoop->lpIterOper() != GT_ADD) || (pLoop->lpIterConst() != 1))
+    if (pLoop->lpIterOper() != GT_ADD)
     {
         JITDUMP("> Loop iteration operator not matching\n");
         return false;
     }
 
+    // The cloning conditions only bound the iterator from above by the array length, so
+    // the increment must not be able to overflow an iterator that is still in range.
+    // Array lengths are at most 0x7FFFFFC7, so any stride up to 56 is safe; we use a
+    // smaller bound that still covers the common unrolled/strided access patterns.
+    const int maxStride = 16;
+    if ((pLoop->lpIterConst() <= 0) || (pLoop->lpIterConst() > maxStride))
+    {
+        JITDUMP("> Loop stride %d is not supported\n", pLoop->lpIterConst());
+        return false;
+    }
+
     if ((pLoop->lpFlags & LPFLG_CONST_LIMIT) == 0 && (pLoop->lpFlags & LPFLG_VAR_LIMIT) == 0 &&
         (pLoop->lpFlags & LPFLG_ARRLEN_LIMIT) == 0)
     {
@@ -0,0 +1,310 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//
+//
+//                                    Redundant Branch Elimination
+//
+// This stage removes conditional branches whose outcome is already implied by a
+// dominating conditional branch on the same (or the reversed) condition. Value
+// numbers are used to identify the conditions, so a branch is recognized as
+// redundant even when the two relops are separate trees (for example, repeated
+// null checks or bounds checks introduced by inlining).
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+#include "jitpch.h"
+
+//------------------------------------------------------------------------
+// optRedundantBranches: try and optimize redundant branches in the method
+//
+// Notes:
+//    Relies on the dominator tree built by SSA and on value numbers, so it
+//    must run after value numbering. Folded branches leave behind unreachable
+//    blocks; those are cleaned up by the flow graph update that follows the
+//    optimization phases.
+//
+void Compiler::optRedundantBranches()
+{
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("\n*************** In optRedundantBranches()\n");
+    }
+#endif // DEBUG
+
+    bool madeChanges = false;
+
+    // Folding branches does not add blocks, so the visited set can be
+    // allocated once and reused by each optReachable query.
+    optReachableBitVecTraits = new (getAllocator(CMK_Reachability)) BitVecTraits(fgBBNumMax + 1, this);
+    optReachableBitVec       = BitVecOps::MakeEmpty(optReachableBitVecTraits);
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if (block->bbJumpKind == BBJ_COND)
+        {
+            madeChanges |= optRedundantBranch(block);
+        }
+    }
+
+    optReachableBitVecTraits = nullptr;
+
+#ifdef DEBUG
+    if (verbose && madeChanges)
+    {
+        printf("\n*************** After optRedundantBranches()\n");
+        fgDispBasicBlocks(true);
+    }
+#endif // DEBUG
+}
+
+//------------------------------------------------------------------------
+// optRedundantBranch: try and optimize a possibly redundant branch
+//
+// Arguments:
+//   block - block with branch to optimize
+//
+// Returns:
+//   True if the branch was folded.
+//
+// Notes:
+//   Walks up the dominator tree looking for a conditional branch whose relop
+//   has the same liberal value number as this block's relop (or as its
+//   reverse). If only one of the dominating branch's successors can reach
+//   this block without passing through the dominating block again, the
+//   outcome of this block's relop is known and the branch is folded.
+//
+bool Compiler::optRedundantBranch(BasicBlock* const block)
+{
+    Statement* const stmt = block->lastStmt();
+
+    if (stmt == nullptr)
+    {
+        return false;
+    }
+
+    GenTree* const jumpTree = stmt->gtStmtExpr;
+
+    if (!jumpTree->OperIs(GT_JTRUE))
+    {
+        return false;
+    }
+
+    GenTree* const tree = jumpTree->gtGetOp1();
+
+    if (!tree->OperIsCompare())
+    {
+        return false;
+    }
+
+    // We are going to drop the relop entirely, so it can't have side effects.
+    if ((tree->gtFlags & GTF_SIDE_EFFECT) != 0)
+    {
+        return false;
+    }
+
+    const ValueNum treeVN = vnStore->VNLiberalNormalValue(tree->gtVNPair);
+
+    // Constant relops are folded by assertion prop.
+    if ((treeVN == ValueNumStore::NoVN) || vnStore->IsVNConstant(treeVN))
+    {
+        return false;
+    }
+
+    const ValueNum treeReversedVN = optReverseRelopVN(treeVN);
+
+    int relopValue = -1;
+
+    for (BasicBlock* domBlock = block->bbIDom; (domBlock != nullptr) && (relopValue == -1);
+         domBlock             = domBlock->bbIDom)
+    {
+        if (domBlock->bbJumpKind != BBJ_COND)
+        {
+            continue;
+        }
+
+        // An exception raised in the dominating block before its branch executes could
+        // reach this block through a handler without the condition having been tested.
+        if (domBlock->hasTryIndex())
+        {
+            continue;
+        }
+
+        Statement* const domStmt = domBlock->lastStmt();
+
+        if ((domStmt == nullptr) || !domStmt->gtStmtExpr->OperIs(GT_JTRUE))
+        {
+            continue;
+        }
+
+        GenTree* const domCmpTree = domStmt->gtStmtExpr->gtGetOp1();
+
+        if (!domCmpTree->OperIsCompare())
+        {
+            continue;
+        }
+
+        const ValueNum domCmpVN   = vnStore->VNLiberalNormalValue(domCmpTree->gtVNPair);
+        const bool     isSame     = (domCmpVN == treeVN);
+        const bool     isReversed = !isSame && (treeReversedVN != ValueNumStore::NoVN) && (domCmpVN == treeReversedVN);
+
+        if (!isSame && !isReversed)
+        {
+            continue;
+        }
+
+        BasicBlock* const trueSuccessor  = domBlock->bbJumpDest;
+        BasicBlock* const falseSuccessor = domBlock->bbNext;
+
+        if (trueSuccessor == falseSuccessor)
+        {
+            continue;
+        }
+
+        const bool trueReaches  = optReachable(trueSuccessor, block, domBlock);
+        const bool falseReaches = optReachable(falseSuccessor, block, domBlock);
+
+        if (trueReaches == falseReaches)
+        {
+            // Either both outcomes flow here, or (if neither does) this block is
+            // only reachable in ways we don't model. Keep looking further up.
+            continue;
+        }
+
+        const int domValue = trueReaches ? 1 : 0;
+        relopValue         = isSame ? domValue : 1 - domValue;
+
+        JITDUMP("\nDominator " FMT_BB " of " FMT_BB " has the %s relop; the branch in " FMT_BB " is always %s\n",
+                domBlock->bbNum, block->bbNum, isSame ? "same" : "reversed", block->bbNum,
+                (relopValue == 1) ? "taken" : "not taken");
+    }
+
+    if (relopValue == -1)
+    {
+        return false;
+    }
+
+    JITDUMP("\nRedundant branch opt in " FMT_BB ":\n", block->bbNum);
+    DISPTREE(jumpTree);
+
+    const ValueNum relopCnsVN = vnStore->VNForIntCon(relopValue);
+    GenTree* const relopCns   = gtNewIconNode(relopValue);
+    relopCns->gtVNPair        = ValueNumPair(relopCnsVN, relopCnsVN);
+    jumpTree->gtOp.gtOp1      = relopCns;
+
+    fgMorphBlockStmt(block, stmt DEBUGARG(__FUNCTION__));
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optReverseRelopVN: compute the value number of the reversed form of a relop
+//
+// Arguments:
+//   relopVN - value number of a relop
+//
+// Returns:
+//   The value number of the logical negation of the relop, or NoVN if it
+//   can't be (cheaply) expressed as a relop value number.
+//
+// Notes:
+//   EQ and NE are exact complements for all operand types since floating
+//   point NE is always unordered. The other relops only reverse into a plain
+//   relop for integral operands.
+//
+ValueNum Compiler::optReverseRelopVN(ValueNum relopVN)
+{
+    VNFuncApp funcApp;
+
+    if (!vnStore->GetVNFunc(relopVN, &funcApp) || (funcApp.m_arity != 2) || (funcApp.m_func >= VNF_Boundary))
+    {
+        return ValueNumStore::NoVN;
+    }
+
+    const genTreeOps oper = genTreeOps(funcApp.m_func);
+
+    if (!GenTree::OperIsCompare(oper))
+    {
+        return ValueNumStore::NoVN;
+    }
+
+    if ((oper != GT_EQ) && (oper != GT_NE) && varTypeIsFloating(vnStore->TypeOfVN(funcApp.m_args[0])))
+    {
+        return ValueNumStore::NoVN;
+    }
+
+    const genTreeOps reversedOper = GenTree::ReverseRelop(oper);
+
+    return vnStore->VNForFunc(TYP_INT, VNFunc(reversedOper), funcApp.m_args[0], funcApp.m_args[1]);
+}
+
+//------------------------------------------------------------------------
+// optReachable: see if there's a path from one block to another,
+//   including paths involving EH flow.
+//
+// Arguments:
+//    fromBlock - staring block
+//    toBlock   - ending block
+//    excludedBlock - ignore paths that flow through this block
+//
+// Returns:
+//    true if there is a path, false if there is no path
+//
+// Notes:
+//    Like fgReachable, but computed on demand (and so accurate given
+//    the current flow graph), and also considers paths involving EH.
+//
+//    The walk follows both normal and exceptional successors, so a block
+//    in a try region (or that flows into one) reaches its handlers. This
+//    matches the SSA dominator tree, which is built from BlockPredsWithEH:
+//    a block reached only through a handler must not be treated as
+//    unreachable from the dominating branch's successor that leads into
+//    the try.
+//
+//    This may overstate "true" reachability in methods where there are
+//    finallies with multiple continuations.
+//
+bool Compiler::optReachable(BasicBlock* const fromBlock, BasicBlock* const toBlock, BasicBlock* const excludedBlock)
+{
+    if (fromBlock == toBlock)
+    {
+        return true;
+    }
+
+    assert(optReachableBitVecTraits != nullptr);
+    BitVecOps::ClearD(optReachableBitVecTraits, optReachableBitVec);
+
+    ArrayStack<BasicBlock*> stack(getAllocator(CMK_Reachability));
+    stack.Push(fromBlock);
+    BitVecOps::AddElemD(optReachableBitVecTraits, optReachableBitVec, fromBlock->bbNum);
+
+    while (!stack.Empty())
+    {
+        BasicBlock* const nextBlock = stack.Pop();
+        assert(nextBlock != toBlock);
+
+        if (nextBlock == excludedBlock)
+        {
+            continue;
+        }
+
+        for (BasicBlock* succ : nextBlock->GetAllSuccs(this))
+        {
+            if (succ == toBlock)
+            {
+                return true;
+            }
+
+            if (BitVecOps::IsMember(optReachableBitVecTraits, optReachableBitVec, succ->bbNum))
+            {
+                continue;
+            }
+
+            BitVecOps::AddElemD(optReachableBitVecTraits, optReachableBitVec, succ->bbNum);
+            stack.Push(succ);
+        }
+    }
+
+    return false;
+}
@@ -2251,7 +2251,10 @@ ClassLoader::~ClassLoader()
 
     FreeModules();
 
-    m_UnresolvedClassLock.Destroy();
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_STRIPES; i++)
+    {
+        m_UnresolvedClassLocks[i].Destroy();
+    }
     m_AvailableClassLock.Destroy();
     m_AvailableTypesLock.Destroy();
 }
@@ -2311,7 +2314,10 @@ VOID ClassLoader::Init(AllocMemTracker *pamTracker)
                                                           UNRESOLVED_CLASS_HASH_BUCKETS, 
                                                           pamTracker);
 
-    m_UnresolvedClassLock.Init(CrstUnresolvedClassLock);
+    for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_STRIPES; i++)
+    {
+        m_UnresolvedClassLocks[i].Init(CrstUnresolvedClassLock);
+    }
 
     // This lock is taken within the classloader whenever we have to enter a
     // type in one of the modules governed by the loader.
@@ -3655,8 +3661,11 @@ TypeHandle ClassLoader::LoadTypeHandleForTypeKey(TypeKey *pTypeKey,
         SString name;
         TypeString::AppendTypeKeyDebug(name, pTypeKey);
         LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: LoadTypeHandleForTypeKey for type %S to level %s\n", name.GetUnicode(), classLoadLevelName[targetLevel]));
-        CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLock);
-        m_pUnresolvedClassHash->Dump();
+        for (DWORD i = 0; i < UNRESOLVED_CLASS_LOCK_STRIPES; i++)
+        {
+            CrstHolder unresolvedClassLockHolder(&m_UnresolvedClassLocks[i]);
+            m_pUnresolvedClassHash->Dump(i, UNRESOLVED_CLASS_LOCK_STRIPES);
+        }
     }
 #endif
 
@@ -3803,7 +3812,8 @@ ClassLoader::LoadTypeHandleForTypeKey_Body(
     }
 
     ReleaseHolder<PendingTypeLoadEntry> pLoadingEntry;
-    CrstHolderWithState unresolvedClassLockHolder(&m_UnresolvedClassLock, false);
+    DWORD dwLockStripe = m_pUnresolvedClassHash->GetStripe(pTypeKey, UNRESOLVED_CLASS_LOCK_STRIPES);
+    CrstHolderWithState unresolvedClassLockHolder(&m_UnresolvedClassLocks[dwLockStripe], false);
 
 retry:
     unresolvedClassLockHolder.Acquire();    
@@ -3936,7 +3946,7 @@ retry:
         COMPlusThrowOM();
     }
 
-    // Leave the global lock, so that other threads may now start waiting on our class's lock
+    // Leave the stripe lock, so that other threads may now start waiting on our class's lock
     unresolvedClassLockHolder.Release();
 
     EX_TRY
@@ -40,7 +40,11 @@ class DynamicResolver;
 class SigPointer;
 
 // Hash table parameter for unresolved class hash
-#define UNRESOLVED_CLASS_HASH_BUCKETS 8
+#define UNRESOLVED_CLASS_HASH_BUCKETS 32
+
+// Number of locks guarding the unresolved class hash. Each lock guards the buckets whose index is
+// congruent to it, so type loads that hash to different stripes don't contend.
+#define UNRESOLVED_CLASS_LOCK_STRIPES 8
 
 // This is information required to look up a type in the loader. Besides the
 // basic name there is the meta data information for the type, whether the
@@ -539,7 +543,7 @@ class ClassLoader
 private:
     // Classes for which load is in progress
     PendingTypeLoadTable  * m_pUnresolvedClassHash;
-    CrstExplicitInit        m_UnresolvedClassLock;
+    CrstExplicitInit        m_UnresolvedClassLocks[UNRESOLVED_CLASS_LOCK_STRIPES];
 
     // Protects addition of elements to module's m_pAvailableClasses.
     // (indeed thus protects addition of elements to any m_pAvailableClasses in any
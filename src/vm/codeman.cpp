@@ -16,6 +16,7 @@
 #include "appdomain.hpp"
 #include "codeman.h"
 #include "nibblemapmacros.h"
+#include "versionedcache.h"
 #include "generics.h"
 #include "dynamicmethod.h"
 #include "eemessagebox.h"
@@ -66,6 +67,116 @@ SVAL_IMPL(LONG, ExecutionManager, m_dwWriterLock);
 #endif
 
 #ifndef DACCESS_COMPILE
+//-----------------------------------------------------------------------------
+// Exception dispatch and stack walks map the same return addresses to their methods over and over (e.g. a method
+// that throws in a loop is unwound through the same frames on every throw). Walking the nibble map back to the
+// method's code header is linear in the size of the method, so results are kept in a small direct-mapped cache
+// (see VersionedCache).
+//
+// Freeing code or deleting a code heap bumps the cache's epoch, which invalidates every entry at once. The epoch is
+// sampled before the nibble map is read, so a lookup that raced with a change is never stored as current.
+//-----------------------------------------------------------------------------
+class MethodCodeLookupCache
+{
+    static VersionedCache<TADDR, TADDR, 1024> s_cache;
+
+    static size_t GetHash(PCODE pc)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (size_t)pc ^ ((size_t)pc >> 10);
+    }
+
+public:
+    static LONG GetEpoch()
+    {
+        WRAPPER_NO_CONTRACT;
+        return s_cache.GetEpoch();
+    }
+
+    // Must be called after the nibble map has been updated
+    static void Invalidate()
+    {
+        WRAPPER_NO_CONTRACT;
+        s_cache.Invalidate();
+    }
+
+    static BOOL TryGet(PCODE pc, LONG epoch, TADDR* pCodeStart)
+    {
+        WRAPPER_NO_CONTRACT;
+        return s_cache.TryGet(GetHash(pc), (TADDR)pc, epoch, pCodeStart);
+    }
+
+    static void TrySet(PCODE pc, LONG epoch, TADDR codeStart)
+    {
+        WRAPPER_NO_CONTRACT;
+        s_cache.TrySet(GetHash(pc), (TADDR)pc, epoch, codeStart);
+    }
+};
+
+VersionedCache<TADDR, TADDR, 1024> MethodCodeLookupCache::s_cache;
+
+//-----------------------------------------------------------------------------
+// Every frame of a stack walk maps its control PC to a RangeSection. The pLastUsed hint in the head of the range list
+// only remembers one section and is deliberately not updated during server GC, so with many code heaps and loaded
+// images the lookups degrade into linear walks of the list while all the GC threads are walking stacks. This cache
+// remembers the RangeSection found for each 64K region of the address space; a hit is still checked against the
+// section's bounds, so regions that straddle two sections are handled correctly.
+//
+// Adding a range never makes a cached answer wrong (ranges don't overlap), but deleting one does, so DeleteRange bumps
+// the epoch while it holds the writer lock. Readers hold the reader lock, so no section they can see is freed under them.
+//-----------------------------------------------------------------------------
+class RangeSectionLookupCache
+{
+    static const DWORD REGION_SHIFT = 16;
+
+    static VersionedCache<TADDR, RangeSection *, 256> s_cache;
+
+    static size_t GetHash(TADDR region)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (size_t)region ^ ((size_t)region >> 8);
+    }
+
+public:
+    static LONG GetEpoch()
+    {
+        WRAPPER_NO_CONTRACT;
+        return s_cache.GetEpoch();
+    }
+
+    // Must be called after a RangeSection has been unlinked, before it is freed
+    static void Invalidate()
+    {
+        WRAPPER_NO_CONTRACT;
+        s_cache.Invalidate();
+    }
+
+    static RangeSection* TryGet(TADDR addr)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        TADDR region = addr >> REGION_SHIFT;
+
+        RangeSection * pRS;
+        if (!s_cache.TryGet(GetHash(region), region, &pRS))
+            return NULL;
+
+        if ((pRS == NULL) || (addr < pRS->LowAddress) || (addr >= pRS->HighAddress))
+            return NULL;
+
+        return pRS;
+    }
+
+    static void TrySet(TADDR addr, LONG epoch, RangeSection * pRS)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        TADDR region = addr >> REGION_SHIFT;
+        s_cache.TrySet(GetHash(region), region, epoch, pRS);
+    }
+};
+
+VersionedCache<TADDR, RangeSection *, 256> RangeSectionLookupCache::s_cache;
 
 CrstStatic ExecutionManager::m_JumpStubCrst;
 CrstStatic ExecutionManager::m_RangeCrst;
@@ -626,6 +737,13 @@ BOOL EEJitManager::CodeHeapIterator::Next()
         {
             BYTE * code = m_Iterator.GetMethodCode();
             CodeHeader * pHdr = (CodeHeader *)(code - sizeof(CodeHeader));
+
+#ifdef _TARGET_AMD64_
+            // The cold section of a split method is not a method of its own
+            if (!pHdr->IsStubCodeBlock() && pHdr->IsColdCodeBlock())
+                continue;
+#endif
+
             m_pCurrent = !pHdr->IsStubCodeBlock() ? pHdr->GetMethodDesc() : NULL;
 
             // LoaderAllocator filter
@@ -1109,6 +1227,17 @@ TADDR IJitManager::GetFuncletStartAddress(EECodeInfo * pCodeInfo)
     pFunctionEntry = FindRootEntry(pFunctionEntry, baseAddress);
 #endif // EXCEPTION_DATA_SUPPORTS_FUNCTION_FRAGMENTS
 
+#ifdef _TARGET_AMD64_
+    // The cold section of a split method has chained unwind info that points back at
+    // the entry of the main method; it is not a funclet.
+    PTR_UNWIND_INFO pUnwindInfo = dac_cast<PTR_UNWIND_INFO>(baseAddress + RUNTIME_FUNCTION__GetUnwindInfoAddress(pFunctionEntry));
+    if ((pUnwindInfo->Flags & UNW_FLAG_CHAININFO) != 0)
+    {
+        pFunctionEntry = dac_cast<PTR_RUNTIME_FUNCTION>(dac_cast<TADDR>(pUnwindInfo) + offsetof(UNWIND_INFO, UnwindCode) +
+                            ALIGN_UP(pUnwindInfo->CountOfUnwindCodes, 2) * sizeof(UNWIND_CODE));
+    }
+#endif // _TARGET_AMD64_
+
     TADDR funcletStartAddress = baseAddress + RUNTIME_FUNCTION__BeginAddress(pFunctionEntry);
 
     return funcletStartAddress;
@@ -1341,7 +1470,11 @@ void EEJitManager::SetCpuInfo()
     //   CORJIT_FLAG_USE_AVX2 if the following feature bit is set (input EAX of 0x07 and input ECX of 0):
     //      CORJIT_FLAG_USE_AVX
     //      AVX2      - EBX bit 5    (buffer[4]  & 0x20)
-    //   CORJIT_FLAG_USE_AVX_512 is not currently set, but defined so that it can be used in future without
+    //   CORJIT_FLAG_USE_AVX_512 if the following feature bits are set (input EAX of 0x07 and input ECX of 0),
+    //   and avx512StateSupport returns 1:
+    //      CORJIT_FLAG_USE_AVX2
+    //      AVX512F   - EBX bit 16   (buffer[6]  & 0x01)
+    //      AVX512VL  - EBX bit 31   (buffer[7]  & 0x80)
     //   CORJIT_FLAG_USE_AES
     //      CORJIT_FLAG_USE_SSE2
     //      AES       - ECX bit 25   (buffer[11] & 0x01)
@@ -1354,7 +1487,6 @@ void EEJitManager::SetCpuInfo()
     //      BMI2 - EBX bit 8         (buffer[5]  & 0x01)
     //   CORJIT_FLAG_USE_LZCNT if the following feature bits are set (input EAX of 80000001H)
     //      LZCNT - ECX bit 5        (buffer[8]  & 0x20)
-    // synchronously updating VM and JIT.
 
     unsigned char buffer[16];
     DWORD maxCpuId = getcpuid(0, buffer);
@@ -1422,6 +1554,13 @@ void EEJitManager::SetCpuInfo()
                                         if ((buffer[4] & 0x20) != 0)        // AVX2
                                         {
                                             CPUCompileFlags.Set(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX2);
+
+                                            if (((buffer[6] & 0x01) != 0) &&    // AVX512F
+                                                ((buffer[7] & 0x80) != 0) &&    // AVX512VL
+                                                (avx512StateSupport() == 1))
+                                            {
+                                                CPUCompileFlags.Set(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX_512);
+                                            }
                                         }
                                     }
                                 }
@@ -1441,6 +1580,7 @@ void EEJitManager::SetCpuInfo()
             if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SIMD16ByteOnly) != 0)
             {
                 CPUCompileFlags.Clear(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX2);
+                CPUCompileFlags.Clear(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX_512);
             }
         }
 
@@ -1958,6 +2098,12 @@ LoaderCodeHeap::LoaderCodeHeap(size_t * pPrivatePCLBytes)
                    0,                       // RangeList *pRangeList
                    TRUE),                   // BOOL fMakeExecutable
     m_cbMinNextPad(0)
+#if defined(_TARGET_AMD64_)
+    , m_ColdLoaderHeap(pPrivatePCLBytes,
+                       0,                   // RangeList *pRangeList
+                       TRUE)                // BOOL fMakeExecutable
+    , m_cbColdMinNextPad(0)
+#endif
 {
     WRAPPER_NO_CONTRACT;
 }
@@ -2135,6 +2281,7 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 
     size_t * pPrivatePCLBytes   = NULL;
     size_t   reserveSize        = pInfo->getReserveSize();
+    size_t   coldReserveSize    = 0;
     size_t   initialRequestSize = pInfo->getRequestSize();
     const BYTE *   loAddr       = pInfo->m_loAddr;
     const BYTE *   hiAddr       = pInfo->m_hiAddr;
@@ -2195,11 +2342,24 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
         }
         else
         {
-            pBaseAddr = ClrVirtualAllocExecutable(reserveSize, MEM_RESERVE, PAGE_NOACCESS);
+#if defined(_TARGET_AMD64_)
+            // The cold code region follows the region for the hot code in the same reservation
+            coldReserveSize = pInfo->getColdReserveSize();
+            if ((DWORD)(reserveSize + coldReserveSize) != reserveSize + coldReserveSize)
+                coldReserveSize = 0;
+#endif
+            pBaseAddr = ClrVirtualAllocExecutable(reserveSize + coldReserveSize, MEM_RESERVE, PAGE_NOACCESS);
             if (!pBaseAddr)
                 ThrowOutOfMemory();
         }
         pCodeHeap->m_LoaderHeap.SetReservedRegion(pBaseAddr, reserveSize, TRUE);
+#if defined(_TARGET_AMD64_)
+        if (coldReserveSize != 0)
+        {
+            // The whole reservation is released with the hot code region
+            pCodeHeap->m_ColdLoaderHeap.SetReservedRegion(pBaseAddr + reserveSize, coldReserveSize, FALSE);
+        }
+#endif
     }
 
 
@@ -2209,7 +2369,6 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
     pHp->pHeap = pCodeHeap;
 
     size_t heapSize = pCodeHeap->m_LoaderHeap.GetReservedBytesFree();
-    size_t nibbleMapSize = HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heapSize));
 
     pHp->startAddress    = (TADDR)pHp + sizeof(HeapList);
 
@@ -2217,12 +2376,20 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
     pHp->maxCodeHeapSize = heapSize;
     pHp->reserveForJumpStubs = fAllocatedFromEmergencyJumpStubReserve ? pHp->maxCodeHeapSize : GetDefaultReserveForJumpStubs(pHp->maxCodeHeapSize);
 
+#if defined(_TARGET_AMD64_)
+    pHp->coldStartAddress = (coldReserveSize != 0) ? (TADDR)pBaseAddr + reserveSize : NULL;
+    pHp->coldEndAddress   = pHp->coldStartAddress;
+    pHp->maxColdCodeSize  = coldReserveSize;
+#endif
+
     _ASSERTE(heapSize >= initialRequestSize);
 
     // We do not need to memset this memory, since ClrVirtualAlloc() guarantees that the memory is zero.
     // Furthermore, if we avoid writing to it, these pages don't come into our working set
 
     pHp->mapBase         = ROUND_DOWN_TO_PAGE(pHp->startAddress);  // round down to next lower page align
+
+    size_t nibbleMapSize = HEAP2MAPSIZE(ROUND_UP_TO_PAGE(pHp->GetMappedEndAddress() - pHp->mapBase));
     pHp->pHdrMap         = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(nibbleMapSize));
 
     LOG((LF_JIT, LL_INFO100,
@@ -2258,6 +2425,29 @@ void * LoaderCodeHeap::AllocMemForCode_NoThrow(size_t header, size_t size, DWORD
     return p;
 }
 
+#if defined(_TARGET_AMD64_)
+void * LoaderCodeHeap::AllocColdMemForCode_NoThrow(size_t header, size_t size, DWORD alignment)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (m_cbColdMinNextPad > (SSIZE_T)header) header = m_cbColdMinNextPad;
+
+    // Jump stubs are never allocated in the cold code region, so there is nothing to reserve for them.
+    // The allocation fails if the heap has no cold code region, as nothing was reserved for it.
+    void * p = m_ColdLoaderHeap.AllocMemForCode_NoThrow(header, size, alignment, 0);
+    if (p == NULL)
+        return NULL;
+
+    // Same as above, cold code blocks must not share nibble map entries either
+    m_cbColdMinNextPad = ALIGN_UP((SIZE_T)p + 1, BYTES_PER_BUCKET) - ((SIZE_T)p + size);
+
+    return p;
+}
+#endif // _TARGET_AMD64_
+
 void CodeHeapRequestInfo::Init()
 { 
     CONTRACTL {
@@ -2361,6 +2551,16 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
 
     pInfo->setReserveSize(reserveSize);
 
+#if defined(_TARGET_AMD64_)
+    // When methods may be split into hot and cold sections, give the heap a separate region for
+    // the cold sections so that they do not dilute the hot code (see EEJitManager::allocCode).
+    // Dynamic methods and heaps that must satisfy an address range keep all of their code together.
+    if (g_pConfig->JitHotColdSplitting() && !pInfo->IsDynamicDomain() && (pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
+    {
+        pInfo->setColdReserveSize(ALIGN_UP(reserveSize / 4, VIRTUAL_ALLOC_RESERVE_GRANULARITY));
+    }
+#endif
+
     HeapList *pHp = NULL;
 
     DWORD flags = RangeSection::RANGE_SECTION_CODEHEAP;
@@ -2393,7 +2593,7 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
     EX_TRY
     {
         TADDR pStartRange = (TADDR) pHp;
-        TADDR pEndRange = (TADDR) &((BYTE*)pHp->startAddress)[pHp->maxCodeHeapSize];
+        TADDR pEndRange = pHp->GetMappedEndAddress();
 
         ExecutionManager::AddCodeRange(pStartRange,
                                        pEndRange,
@@ -2542,6 +2742,11 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
 #ifdef FEATURE_EH_FUNCLETS
                                     , UINT nUnwindInfos
                                     , TADDR * pModuleBase
+#endif
+#ifdef _TARGET_AMD64_
+                                    , ULONG hotCodeSize
+                                    , ULONG coldCodeSize
+                                    , TADDR * pColdCode
 #endif
                                     )
 {
@@ -2587,13 +2792,32 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
 
     CodeHeapRequestInfo requestInfo(pMD);
 #if defined(FEATURE_JIT_PITCHING)
-    if (pMD && pMD->IsPitchable() && CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMethodSizeThreshold) < blockSize)
+    if (pMD && pMD->IsPitchable() && CLRConfig::GetConfigValue(CLRConfig::INTERNAL_JitPitchMethodSizeThreshold) < blockSize
+#ifdef _TARGET_AMD64_
+        // Pitched code is freed as a single block, so it cannot have a separate cold section
+        && (coldCodeSize == 0)
+#endif
+        )
     {
         requestInfo.SetDynamicDomain();
     }
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+#ifdef _TARGET_AMD64_
+    _ASSERTE((coldCodeSize == 0) || !requestInfo.IsDynamicDomain());
+
+    // The cold section has to be in the same code heap as the hot section since its unwind info
+    // is relative to the same base. Leave enough room after the hot section to fall back to
+    // placing the cold section there when the cold code region of the heap is exhausted.
+    size_t coldCodeReserve = 0;
+    if (coldCodeSize != 0)
+    {
+        coldCodeReserve = sizeof(CodeHeader) + coldCodeSize + (alignment - 1) + BYTES_PER_BUCKET;
+        requestInfo.setReserveForJumpStubs(reserveForJumpStubs + coldCodeReserve);
+    }
+#endif
+
 #if defined(USE_INDIRECT_CODEHEADER)
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos); 
 
@@ -2656,6 +2880,43 @@ CodeHeader* EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t re
         *pModuleBase = (TADDR)pCodeHeap;
 #endif
 
+#ifdef _TARGET_AMD64_
+        pCodeHdr->SetColdCode(NULL, hotCodeSize);
+
+        if (coldCodeSize != 0)
+        {
+            TADDR pColdCode = (TADDR)pCodeHeap->pHeap->AllocColdMemForCode_NoThrow(sizeof(CodeHeader), coldCodeSize, alignment);
+
+            if (pColdCode != NULL)
+            {
+                if (pColdCode + coldCodeSize > pCodeHeap->coldEndAddress)
+                    pCodeHeap->coldEndAddress = pColdCode + coldCodeSize;
+            }
+            else
+            {
+                // The heap has no cold code region or it is full, use the room reserved after the hot section
+                pColdCode = (TADDR)pCodeHeap->pHeap->AllocMemForCode_NoThrow(sizeof(CodeHeader), coldCodeSize, alignment, reserveForJumpStubs);
+                if (pColdCode == NULL)
+                    ThrowOutOfMemory();
+
+                if (pColdCode + coldCodeSize > pCodeHeap->endAddress)
+                    pCodeHeap->endAddress = pColdCode + coldCodeSize;
+            }
+
+            _ASSERTE(IS_ALIGNED(pColdCode, alignment));
+
+            // The cold section gets its own CodeHeader so that the nibble map can find it, but it shares
+            // the real header with the hot section, which is where the code manager looks up the method.
+            CodeHeader * pColdCodeHdr = ((CodeHeader *)pColdCode) - 1;
+            pColdCodeHdr->SetRealCodeHeader((BYTE*)pCodeHdr->pRealCodeHeader);
+            pCodeHdr->SetColdCode(pColdCode, hotCodeSize);
+
+            NibbleMapSet(pCodeHeap, pColdCode, TRUE);
+
+            *pColdCode = pColdCode;
+        }
+#endif
+
         NibbleMapSet(pCodeHeap, pCode, TRUE);
     }
 
@@ -3222,6 +3483,12 @@ void EEJitManager::RemoveJitData (CodeHeader * pCHdr, size_t GCinfo_len, size_t
             return;
 
         NibbleMapSet(pHp, (TADDR)(pCHdr + 1), FALSE);
+
+#ifdef _TARGET_AMD64_
+        // The cold section of a split method is always in the same heap as its hot section
+        if (pCHdr->GetColdCodeStartAddress() != NULL)
+            NibbleMapSet(pHp, pCHdr->GetColdCodeStartAddress(), FALSE);
+#endif
     }
 
     // Backout the GCInfo  
@@ -3540,6 +3807,9 @@ void EEJitManager::DeleteCodeHeap(HeapList *pHeapList)
 
     ExecutionManager::DeleteRange((TADDR)pHeapList);
 
+    // The address range may be reused by a new code heap
+    MethodCodeLookupCache::Invalidate();
+
     LOG((LF_JIT, LL_INFO100, "DeleteCodeHeap start" FMT_ADDR "end" FMT_ADDR "\n",
                               (const BYTE*)pHeapList->startAddress, 
                               (const BYTE*)pHeapList->endAddress     ));
@@ -3658,6 +3928,13 @@ PCODE EEJitManager::GetCodeAddressForRelOffset(const METHODTOKEN& MethodToken, D
     WRAPPER_NO_CONTRACT;
 
     CodeHeader * pHeader = GetCodeHeader(MethodToken);
+
+#ifdef _TARGET_AMD64_
+    // Offsets past the hot code of a split method are in its cold section
+    if ((pHeader->GetColdCodeStartAddress() != NULL) && (relOffset >= pHeader->GetHotCodeSize()))
+        return pHeader->GetColdCodeStartAddress() + (relOffset - pHeader->GetHotCodeSize());
+#endif // _TARGET_AMD64_
+
     return pHeader->GetCodeStartAddress() + relOffset;
 }
 
@@ -3685,6 +3962,19 @@ BOOL EEJitManager::JitCodeToMethodInfo(
 
     _ASSERTE(pCHdr->GetMethodDesc()->SanityCheck());
 
+    DWORD relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+
+#ifdef _TARGET_AMD64_
+    if (pCHdr->IsColdCodeBlock())
+    {
+        // The cold section of a split method. Offsets in it continue from the end of the hot code,
+        // and the method token is the header of the hot code, which the main unwind info points at.
+        relOffset += pCHdr->GetHotCodeSize();
+        pCHdr = PTR_CodeHeader(pRangeSection->LowAddress + RUNTIME_FUNCTION__BeginAddress(pCHdr->GetUnwindInfo(0)) - sizeof(CodeHeader));
+        _ASSERTE(pCHdr->GetColdCodeStartAddress() == start);
+    }
+#endif // _TARGET_AMD64_
+
     if (pCodeInfo)
     {
         pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pCHdr));
@@ -3692,7 +3982,7 @@ BOOL EEJitManager::JitCodeToMethodInfo(
         // This can be counted on for Jitted code. For NGEN code in the case
         // where we have hot/cold splitting this isn't valid and we need to
         // take into account cold code.
-        pCodeInfo->m_relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+        pCodeInfo->m_relOffset = relOffset;
 
 #ifdef FEATURE_EH_FUNCLETS
         // Computed lazily by code:EEJitManager::LazyGetFunctionEntry
@@ -3736,6 +4026,8 @@ TADDR EEJitManager::FindMethodCode(PCODE currentPC)
     return dac_cast<PTR_EEJitManager>(pRS->pjit)->FindMethodCode(pRS, currentPC);
 }
 
+static TADDR FindMethodCodeInNibbleMap(HeapList * pHp, PCODE currentPC);
+
 // Finds the header corresponding to the code at offset "delta".
 // Returns NULL if there is no header for the given "delta"
 
@@ -3750,9 +4042,37 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
     if ((currentPC < pHp->startAddress) ||
         (currentPC > pHp->endAddress))
     {
-        return NULL;
+#ifdef _TARGET_AMD64_
+        // Cold sections of split methods
+        if ((currentPC < pHp->coldStartAddress) ||
+            (currentPC > pHp->coldEndAddress))
+#endif
+        {
+            return NULL;
+        }
     }
 
+#ifndef DACCESS_COMPILE
+    LONG epoch = MethodCodeLookupCache::GetEpoch();
+
+    TADDR codeStart;
+    if (MethodCodeLookupCache::TryGet(currentPC, epoch, &codeStart))
+        return codeStart;
+
+    codeStart = FindMethodCodeInNibbleMap(pHp, currentPC);
+    if (codeStart != NULL)
+        MethodCodeLookupCache::TrySet(currentPC, epoch, codeStart);
+
+    return codeStart;
+#else // !DACCESS_COMPILE
+    return FindMethodCodeInNibbleMap(pHp, currentPC);
+#endif // !DACCESS_COMPILE
+}
+
+static TADDR FindMethodCodeInNibbleMap(HeapList * pHp, PCODE currentPC)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
     TADDR base = pHp->mapBase;
     TADDR delta = currentPC - base;
     PTR_DWORD pMap = pHp->pHdrMap;
@@ -3859,6 +4179,13 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
 
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
+
+    // Adding code never changes the method an already cached PC belongs to; removing it does,
+    // since the space may be reused for another method.
+    if (!bSet)
+    {
+        MethodCodeLookupCache::Invalidate();
+    }
 }
 #endif // !DACCESS_COMPILE
 
@@ -3886,6 +4213,14 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
     // Thus, save it off right now.
     TADDR baseAddress = pCodeInfo->GetModuleBase();
 
+#ifdef _TARGET_AMD64_
+    // Offsets past the hot code of a split method are in its cold section
+    if ((pHeader->GetColdCodeStartAddress() != NULL) && (pCodeInfo->GetRelOffset() >= pHeader->GetHotCodeSize()))
+    {
+        address = (DWORD)(pHeader->GetColdCodeStartAddress() - baseAddress) + (pCodeInfo->GetRelOffset() - pHeader->GetHotCodeSize());
+    }
+#endif // _TARGET_AMD64_
+
     // NOTE: We could binary search here, if it would be helpful (e.g., large number of funclets)
     for (UINT iUnwindInfo = 0; iUnwindInfo < pHeader->GetNumberOfUnwindInfos(); iUnwindInfo++)
     {
@@ -3937,6 +4272,15 @@ DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD
         }
 #endif // EXCEPTION_DATA_SUPPORTS_FUNCTION_FRAGMENTS
 
+#ifdef _TARGET_AMD64_
+        PTR_UNWIND_INFO pUnwindInfo = dac_cast<PTR_UNWIND_INFO>(moduleBase + RUNTIME_FUNCTION__GetUnwindInfoAddress(pFunctionEntry));
+        if ((pUnwindInfo->Flags & UNW_FLAG_CHAININFO) != 0)
+        {
+            // This is the cold section of the main method (see CEEJitInfo::allocMem); skip it
+            continue;
+        }
+#endif // _TARGET_AMD64_
+
         DWORD funcletBeginRva = RUNTIME_FUNCTION__BeginAddress(pFunctionEntry);
         DWORD relParentOffsetToFunclet = funcletBeginRva - parentBeginRva;
 
@@ -4102,10 +4446,26 @@ void EEJitManager::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
         DacEnumMemoryRegion(heap->startAddress, (ULONG32)
                             (heap->endAddress - heap->startAddress));
 
+#if defined(_TARGET_AMD64_)
+        if (heap->coldStartAddress != NULL)
+        {
+            DacEnumMemoryRegion(heap->coldStartAddress, (ULONG32)
+                                (heap->coldEndAddress - heap->coldStartAddress));
+        }
+#endif
+
         if (heap->pHdrMap.IsValid())
         {
             ULONG32 nibbleMapSize = (ULONG32)
                 HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heap->maxCodeHeapSize));
+#if defined(_TARGET_AMD64_)
+            // The nibble map of a heap with a cold code region covers that region too
+            if (heap->coldStartAddress != NULL)
+            {
+                nibbleMapSize = (ULONG32)
+                    HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heap->GetMappedEndAddress() - heap->mapBase));
+            }
+#endif
             DacEnumMemoryRegion(dac_cast<TADDR>(heap->pHdrMap), nibbleMapSize);
         }
     }
@@ -4467,6 +4827,14 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
     RangeSection *pLast = NULL;
 
 #ifndef DACCESS_COMPILE
+    RangeSection *pCachedRS = RangeSectionLookupCache::TryGet(addr);
+    if (pCachedRS != NULL)
+    {
+        return pCachedRS;
+    }
+
+    LONG epoch = RangeSectionLookupCache::GetEpoch();
+
     RangeSection *pLastUsedRS = (pCurr != NULL) ? pCurr->pLastUsed : NULL;
 
     if (pLastUsedRS != NULL)
@@ -4524,6 +4892,9 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
     // due to many processors writing to a common location
     if (g_SystemInfo.dwNumberOfProcessors < 4 || !GCHeapUtilities::IsServerHeap() || !GCHeapUtilities::IsGCInProgress())
         pHead->pLastUsed = pLast;
+
+    if (pCurr != NULL)
+        RangeSectionLookupCache::TrySet(addr, epoch, pCurr);
 #endif
 
     return pCurr;
@@ -4827,6 +5198,8 @@ void ExecutionManager::DeleteRange(TADDR pStartRange)
                 head->pLastUsed = NULL;
             }
 
+            RangeSectionLookupCache::Invalidate();
+
             //
             // Cannot delete pCurr here because we own the WriterLock and if this is
             // a hosted scenario then the hosting api callback cannot occur in a forbid
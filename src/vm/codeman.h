@@ -149,6 +149,15 @@ public:
 
     PTR_MethodDesc      phdrMDesc;
 
+#ifdef _TARGET_AMD64_
+    // The cold section of a hot/cold split method lives in its own code block, with its own
+    // CodeHeader pointing at this RealCodeHeader (see EEJitManager::allocCode). The JIT reports
+    // offsets in the cold code as if it followed the hot code, so the hot code size is needed
+    // to map cold code addresses back to method offsets. Both are 0 for methods that are not split.
+    TADDR               phdrColdCodeStart;
+    DWORD               phdrHotCodeSize;
+#endif // _TARGET_AMD64_
+
 #ifdef FEATURE_EH_FUNCLETS
     DWORD               nUnwindInfos;
     T_RUNTIME_FUNCTION  unwindInfos[0];
@@ -324,6 +333,30 @@ public:
         pRealCodeHeader = (PTR_RealCodeHeader)kind;
     }
 
+#ifdef _TARGET_AMD64_
+    TADDR                   GetColdCodeStartAddress()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrColdCodeStart;
+    }
+    DWORD                   GetHotCodeSize()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrHotCodeSize;
+    }
+    // Is this the header of the cold section of a split method, rather than of the method itself?
+    BOOL                    IsColdCodeBlock()
+    {
+        SUPPORTS_DAC;
+        return GetCodeStartAddress() == GetColdCodeStartAddress();
+    }
+    void SetColdCode(TADDR pColdCode, DWORD hotCodeSize)
+    {
+        pRealCodeHeader->phdrColdCodeStart = pColdCode;
+        pRealCodeHeader->phdrHotCodeSize = hotCodeSize;
+    }
+#endif // _TARGET_AMD64_
+
 #if defined(FEATURE_EH_FUNCLETS)
     UINT                    GetNumberOfUnwindInfos()
     {
@@ -367,6 +400,7 @@ struct CodeHeapRequestInfo
     size_t       m_requestSize;     // minimum size that must be made available
     size_t       m_reserveSize;     // Amount that VirtualAlloc will reserved
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
+    size_t       m_coldReserveSize; // Amount to reserve for the cold code region of a new code heap (AMD64 only)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
     bool         m_throwOnOutOfMemoryWithinRange;
@@ -385,6 +419,9 @@ struct CodeHeapRequestInfo
     size_t getReserveForJumpStubs()             { return m_reserveForJumpStubs; }
     void   setReserveForJumpStubs(size_t size)  { m_reserveForJumpStubs = size; }
 
+    size_t getColdReserveSize()                 { return m_coldReserveSize; }
+    void   setColdReserveSize(size_t size)      { m_coldReserveSize = size; }
+
     bool   getThrowOnOutOfMemoryWithinRange()   { return m_throwOnOutOfMemoryWithinRange; }
     void   setThrowOnOutOfMemoryWithinRange(bool value) { m_throwOnOutOfMemoryWithinRange = value; }
         
@@ -393,14 +430,14 @@ struct CodeHeapRequestInfo
     CodeHeapRequestInfo(MethodDesc *pMD)
         : m_pMD(pMD), m_pAllocator(0), 
           m_loAddr(0), m_hiAddr(0),
-          m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0)
+          m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0), m_coldReserveSize(0)
     { WRAPPER_NO_CONTRACT;   Init(); }
     
     CodeHeapRequestInfo(MethodDesc *pMD, LoaderAllocator* pAllocator,
                         BYTE * loAddr, BYTE * hiAddr)
         : m_pMD(pMD), m_pAllocator(pAllocator), 
           m_loAddr(loAddr), m_hiAddr(hiAddr),
-          m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0)
+          m_requestSize(0), m_reserveSize(0), m_reserveForJumpStubs(0), m_coldReserveSize(0)
     { WRAPPER_NO_CONTRACT;   Init(); }
 };
 
@@ -444,6 +481,15 @@ public:
     // Space for header is reserved immediately before. It is not included in size.
     virtual void* AllocMemForCode_NoThrow(size_t header, size_t size, DWORD alignment, size_t reserveForJumpStubs) = 0;
 
+    // Same as above, but for the cold section of a hot/cold split method. The memory comes from
+    // the cold code region of the heap, away from the hot code. Returns NULL if the heap has no
+    // cold code region or the request does not fit.
+    virtual void* AllocColdMemForCode_NoThrow(size_t header, size_t size, DWORD alignment)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return NULL;
+    }
+
 #ifdef DACCESS_COMPILE
     virtual void EnumMemoryRegions(CLRDataEnumMemoryFlags flags) = 0;
 #endif
@@ -484,6 +530,26 @@ typedef struct _HeapList
     UINT32      CLRPersonalityRoutine[JUMP_ALLOCATE_SIZE/sizeof(UINT32)];  // jump thunk to personality routine    
 #endif
 
+#if defined(_TARGET_AMD64_)
+    // Region after the end of the code heap that holds the cold sections of hot/cold split methods.
+    // It is covered by the nibble map and the range section of the heap, so cold code shares the
+    // module base of the hot code. coldStartAddress is 0 if there is no such region.
+    TADDR               coldStartAddress;
+    TADDR               coldEndAddress; // the current end of the used portion of the cold code region
+    size_t              maxColdCodeSize;
+#endif
+
+    // The end of the address range covered by the nibble map and the range section of the heap
+    TADDR GetMappedEndAddress()
+    {
+        SUPPORTS_DAC;
+#if defined(_TARGET_AMD64_)
+        if (coldStartAddress != NULL)
+            return coldStartAddress + maxColdCodeSize;
+#endif
+        return startAddress + maxCodeHeapSize;
+    }
+
     PTR_HeapList GetNext()
     { SUPPORTS_DAC; return hpNext; }
 
@@ -510,6 +576,11 @@ class LoaderCodeHeap : CodeHeap
 private:
     ExplicitControlLoaderHeap m_LoaderHeap;
     SSIZE_T m_cbMinNextPad;
+#if defined(_TARGET_AMD64_)
+    // Reserved region for the cold code, carved out of the end of the same reservation
+    ExplicitControlLoaderHeap m_ColdLoaderHeap;
+    SSIZE_T m_cbColdMinNextPad;
+#endif
 
     LoaderCodeHeap(size_t * pPrivatePCLBytes);
 
@@ -523,12 +594,18 @@ public:
     }
 
     virtual void* AllocMemForCode_NoThrow(size_t header, size_t size, DWORD alignment, size_t reserveForJumpStubs) DAC_EMPTY_RET(NULL);
+#if defined(_TARGET_AMD64_)
+    virtual void* AllocColdMemForCode_NoThrow(size_t header, size_t size, DWORD alignment) DAC_EMPTY_RET(NULL);
+#endif
 
 #ifdef DACCESS_COMPILE
     virtual void EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
     {
         WRAPPER_NO_CONTRACT;
         m_LoaderHeap.EnumMemoryRegions(flags);
+#if defined(_TARGET_AMD64_)
+        m_ColdLoaderHeap.EnumMemoryRegions(flags);
+#endif
     }
 #endif
 };
@@ -1014,6 +1091,11 @@ public:
 #ifdef FEATURE_EH_FUNCLETS
                                   , UINT nUnwindInfos
                                   , TADDR * pModuleBase
+#endif
+#ifdef _TARGET_AMD64_
+                                  , ULONG hotCodeSize
+                                  , ULONG coldCodeSize
+                                  , TADDR * pColdCode
 #endif
                                   );
     BYTE *              allocGCInfo(CodeHeader* pCodeHeader, DWORD blockSize, size_t * pAllocationSize);
@@ -1544,6 +1626,17 @@ inline void EEJitManager::JitTokenToMethodRegionInfo(const METHODTOKEN& MethodTo
     methodRegionInfo->hotSize          = GetCodeManager()->GetFunctionSize(GetGCInfoToken(MethodToken));
     methodRegionInfo->coldStartAddress = 0;
     methodRegionInfo->coldSize         = 0;
+
+#ifdef _TARGET_AMD64_
+    CodeHeader * pCH = GetCodeHeader(MethodToken);
+    if (pCH->GetColdCodeStartAddress() != NULL)
+    {
+        // The function size covers both sections of a split method
+        methodRegionInfo->coldStartAddress = pCH->GetColdCodeStartAddress();
+        methodRegionInfo->coldSize         = methodRegionInfo->hotSize - pCH->GetHotCodeSize();
+        methodRegionInfo->hotSize          = pCH->GetHotCodeSize();
+    }
+#endif // _TARGET_AMD64_
 }
 
 
@@ -456,6 +456,13 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
     pHp->maxCodeHeapSize = m_TotalBytesAvailable - pTracker->size;
     pHp->reserveForJumpStubs = 0;
 
+#if defined(_TARGET_AMD64_)
+    // Dynamic methods are never split, so there is no cold code region
+    pHp->coldStartAddress = NULL;
+    pHp->coldEndAddress = NULL;
+    pHp->maxColdCodeSize = 0;
+#endif
+
 #ifdef BIT64
     emitJump((LPBYTE)pHp->CLRPersonalityRoutine, (void *)ProcessCLRException);
 #endif
@@ -195,12 +195,14 @@ HRESULT EEConfig::Init()
     dwMonitorSpinCount = 0;
 
     dwJitHostMaxSlabCache = 0;
+    dwJitHostMaxThreadSlabCache = 0;
 
     iJitOptimizeType = OPT_DEFAULT;
     fJitFramed = false;
     fJitAlignLoops = false;
     fAddRejitNops = false;
     fJitMinOpts = false;
+    fJitHotColdSplitting = false;
     fPInvokeRestoreEsp = (DWORD)-1;
 
     fLegacyNullReferenceExceptionPolicy = false;
@@ -990,10 +992,12 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
     dwMonitorSpinCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_Monitor_SpinCount);
 
     dwJitHostMaxSlabCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHostMaxSlabCache);
+    dwJitHostMaxThreadSlabCache = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHostMaxThreadSlabCache);
 
     fJitFramed = (GetConfigDWORD_DontUse_(CLRConfig::UNSUPPORTED_JitFramed, fJitFramed) != 0);
     fJitAlignLoops = (GetConfigDWORD_DontUse_(CLRConfig::UNSUPPORTED_JitAlignLoops, fJitAlignLoops) != 0);
     fJitMinOpts = (GetConfigDWORD_DontUse_(CLRConfig::UNSUPPORTED_JITMinOpts, fJitMinOpts) == 1);
+    fJitHotColdSplitting = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_JitHotColdSplitting) != 0);
     iJitOptimizeType      =  GetConfigDWORD_DontUse_(CLRConfig::EXTERNAL_JitOptimizeType, iJitOptimizeType);
     if (iJitOptimizeType > OPT_RANDOM)     iJitOptimizeType = OPT_DEFAULT;
 
@@ -272,12 +272,14 @@ public:
     // Jit-config
 
     DWORD         JitHostMaxSlabCache(void)                 const {LIMITED_METHOD_CONTRACT;  return dwJitHostMaxSlabCache; }
+    DWORD         JitHostMaxThreadSlabCache(void)           const {LIMITED_METHOD_CONTRACT;  return dwJitHostMaxThreadSlabCache; }
     bool          GetTrackDynamicMethodDebugInfo(void)      const {LIMITED_METHOD_CONTRACT;  return fTrackDynamicMethodDebugInfo; }    
     unsigned int  GenOptimizeType(void)                     const {LIMITED_METHOD_CONTRACT;  return iJitOptimizeType; }
     bool          JitFramed(void)                           const {LIMITED_METHOD_CONTRACT;  return fJitFramed; }
     bool          JitAlignLoops(void)                       const {LIMITED_METHOD_CONTRACT;  return fJitAlignLoops; }
     bool          AddRejitNops(void)                        const {LIMITED_METHOD_DAC_CONTRACT;  return fAddRejitNops; }
     bool          JitMinOpts(void)                          const {LIMITED_METHOD_CONTRACT;  return fJitMinOpts; }
+    bool          JitHotColdSplitting(void)                 const {LIMITED_METHOD_CONTRACT;  return fJitHotColdSplitting; }
     
     // Tiered Compilation config
 #if defined(FEATURE_TIERED_COMPILATION)
@@ -757,6 +759,7 @@ public:
         GCPOLL_TYPE_HIJACK,     // Depend on thread hijacking for gc suspension
         GCPOLL_TYPE_POLL,       // Emit function calls to a helper for GC Poll
         GCPOLL_TYPE_INLINE,     // Emit inlined tests to the helper for GC Poll
+        GCPOLL_TYPE_TIER1,      // Emit inlined tests in optimized code only, hijack everything else
         GCPOLL_TYPE_COUNT
     };
     GCPollType GetGCPollType() { LIMITED_METHOD_CONTRACT; return iGCPollType; }
@@ -784,11 +787,13 @@ private: //----------------------------------------------------------------
     // Jit-config
 
     DWORD dwJitHostMaxSlabCache;       // max size for jit host slab cache
+    DWORD dwJitHostMaxThreadSlabCache; // max number of jit host slabs cached per thread
     bool fTrackDynamicMethodDebugInfo; //  Enable/Disable tracking dynamic method debug info
     bool fJitFramed;                   // Enable/Disable EBP based frames
     bool fJitAlignLoops;               // Enable/Disable loop alignment
     bool fAddRejitNops;                // Enable/Disable nop padding for rejit.          default is true
     bool fJitMinOpts;                  // Enable MinOpts for all jitted methods
+    bool fJitHotColdSplitting;         // Enable/Disable splitting jitted methods into hot and cold sections
 
     unsigned iJitOptimizeType; // 0=Blended,1=SmallCode,2=FastCode,              default is 0=Blended
     
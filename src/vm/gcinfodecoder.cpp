@@ -784,19 +784,31 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Read the live state a word at a time rather than a bit at a time. Methods
+            // with many tracked slots usually have only a few of them live at any given
+            // safepoint, so this lets us skip over the dead ones quickly.
+            for(UINT32 chunkStart = 0; chunkStart < numSlots; chunkStart += (UINT32)BITS_PER_SIZE_T)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 chunkSize = numSlots - chunkStart;
+                if(chunkSize > (UINT32)BITS_PER_SIZE_T)
+                    chunkSize = (UINT32)BITS_PER_SIZE_T;
+
+                size_t liveSlots = m_Reader.Read((int)chunkSize);
+
+                for(UINT32 slotIndex = chunkStart; liveSlots != 0; slotIndex++, liveSlots >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveSlots & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                slotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                    }
                 }
             }
             goto ReportUntracked;
@@ -871,9 +883,14 @@ bool GcInfoDecoder::EnumerateLiveSlots(
             }
             else 
             {
-                for(UINT32 i = 0; i < numSlots; i++)
+                for(UINT32 chunkStart = 0; chunkStart < numSlots; chunkStart += (UINT32)BITS_PER_SIZE_T)
                 {
-                    if(m_Reader.ReadOneFast())
+                    UINT32 chunkSize = numSlots - chunkStart;
+                    if(chunkSize > (UINT32)BITS_PER_SIZE_T)
+                        chunkSize = (UINT32)BITS_PER_SIZE_T;
+
+                    // Count the set bits, clearing the lowest one each time around.
+                    for(size_t couldBeLive = m_Reader.Read((int)chunkSize); couldBeLive != 0; couldBeLive &= (couldBeLive - 1))
                         numCouldBeLiveSlots++;
                 }
             }
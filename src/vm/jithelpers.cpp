@@ -44,6 +44,7 @@
 #include "debuginfostore.h"
 #include "safemath.h"
 #include "threadstatics.h"
+#include "versionedcache.h"
 
 #ifdef FEATURE_PREJIT
 #include "compile.h"
@@ -2071,6 +2072,105 @@ HCIMPLEND_RAW
 //
 //========================================================================
 
+//
+// CastCache remembers the outcome of casts that had to be resolved by the framed slow path
+// (variant and generic interfaces, arrays of interfaces, type equivalence, ...) so that the
+// frameless helpers can answer them without walking the type hierarchy again.
+//
+// The cache is a fixed-size, direct-mapped table keyed by (source type, target type). For
+// arrays the source type is the pair of the array MethodTable and its element type handle,
+// since the MethodTable is shared by all arrays of reference types of a given rank.
+//
+// Entries are written without taking a lock; see VersionedCache. A writer that finds the
+// entry busy simply doesn't cache its result.
+//
+// Casts involving collectible types are never cached, so entries can't outlive the types
+// they refer to. COM objects and ICastable implementations are not cached either, because
+// the outcome of a cast depends on the instance and not only on its type.
+//
+class CastCache
+{
+    struct Key
+    {
+        TADDR m_source;
+        TADDR m_sourceParam;
+        TADDR m_target;
+    };
+
+    static VersionedCache<Key, TADDR, 4096> s_cache;
+
+    static void GetKey(Object* pObject, TypeHandle toTypeHnd, Key* pKey)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        MethodTable* pMT    = pObject->GetMethodTable();
+        pKey->m_source      = dac_cast<TADDR>(pMT);
+        pKey->m_sourceParam = pMT->IsArray() ? ((ArrayBase*)pObject)->GetArrayElementTypeHandle().AsTAddr() : 0;
+        pKey->m_target      = toTypeHnd.AsTAddr();
+    }
+
+    static size_t GetHash(const Key& key)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // The low bits of these pointers are always zero, fold them away before mixing.
+        size_t hash = (key.m_source >> 3) ^ (key.m_sourceParam >> 2) ^ ((key.m_target >> 3) * 0x9E3779B1);
+        hash ^= hash >> 12;
+        return hash;
+    }
+
+public:
+    //------------------------------------------------------------------------
+    // TryGet: Look up a previously resolved cast.
+    //
+    // Return Value:
+    //    CanCast or CannotCast if the cast is cached, MaybeCast otherwise.
+    //
+    static TypeHandle::CastResult TryGet(Object* pObject, TypeHandle toTypeHnd)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        Key key;
+        GetKey(pObject, toTypeHnd, &key);
+
+        TADDR canCast;
+        if (!s_cache.TryGet(GetHash(key), key, &canCast))
+            return TypeHandle::MaybeCast;
+
+        return (canCast != 0) ? TypeHandle::CanCast : TypeHandle::CannotCast;
+    }
+
+    //------------------------------------------------------------------------
+    // TrySet: Remember the result of a cast resolved by the slow path.
+    //
+    static void TrySet(Object* pObject, TypeHandle toTypeHnd, BOOL canCast)
+    {
+        CONTRACTL {
+            NOTHROW;
+            GC_NOTRIGGER;
+            MODE_COOPERATIVE;
+        } CONTRACTL_END;
+
+        MethodTable* pMT = pObject->GetMethodTable();
+
+        if (pMT->IsComObjectType() || pMT->IsICastable())
+            return;
+
+        if (pMT->Collectible() || toTypeHnd.GetLoaderAllocator()->IsCollectible())
+            return;
+
+        Key key;
+        GetKey(pObject, toTypeHnd, &key);
+
+        if ((key.m_sourceParam != 0) && TypeHandle::FromTAddr(key.m_sourceParam).GetLoaderAllocator()->IsCollectible())
+            return;
+
+        s_cache.TrySet(GetHash(key), key, (TADDR)(canCast ? 1 : 0));
+    }
+};
+
+VersionedCache<CastCache::Key, TADDR, 4096> CastCache::s_cache;
+
 // pObject MUST be an instance of an array.
 TypeHandle::CastResult ArrayIsInstanceOfNoGC(Object *pObject, TypeHandle toTypeHnd)
 {
@@ -2176,6 +2276,10 @@ TypeHandle::CastResult STDCALL ObjIsInstanceOfNoGC(Object *pObject, TypeHandle t
         return TypeHandle::MaybeCast;
     }
 
+    TypeHandle::CastResult cachedResult = CastCache::TryGet(pObject, toTypeHnd);
+    if (cachedResult != TypeHandle::MaybeCast)
+        return cachedResult;
+
     if (pMT->IsArray())
     {
         if (toTypeHnd.IsArray())
@@ -2274,6 +2378,9 @@ BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd, BOOL throwCastExcept
     }
 #endif // FEATURE_ICASTABLE
 
+    // TrySet skips the instance-dependent (COM and ICastable) cases.
+    CastCache::TrySet(OBJECTREFToObject(obj), toTypeHnd, fCast);
+
     if (!fCast && throwCastException) 
     {
         COMPlusThrowInvalidCastException(&obj, toTypeHnd);
@@ -2443,6 +2550,11 @@ HCIMPL2(Object *, JIT_ChkCastArray, CORINFO_CLASS_HANDLE type, Object *pObject)
     TypeHandle::CastResult result = refObj->GetMethodTable()->IsArray() ? 
         ArrayIsInstanceOfNoGC(pObject, TypeHandle(type)) : TypeHandle::CannotCast;
 
+    if (result == TypeHandle::MaybeCast)
+    {
+        result = CastCache::TryGet(pObject, TypeHandle(type));
+    }
+
     if (result == TypeHandle::CanCast)
     {
         return pObject;
@@ -2480,7 +2592,13 @@ HCIMPL2(Object *, JIT_IsInstanceOfArray, CORINFO_CLASS_HANDLE type, Object *pObj
     }
     else
     {
-        switch (ArrayIsInstanceOfNoGC(pObject, TypeHandle(type))) {
+        TypeHandle::CastResult result = ArrayIsInstanceOfNoGC(pObject, TypeHandle(type));
+        if (result == TypeHandle::MaybeCast)
+        {
+            result = CastCache::TryGet(pObject, TypeHandle(type));
+        }
+
+        switch (result) {
         case TypeHandle::CanCast:
             return pObject;
         case TypeHandle::CannotCast:
@@ -2556,17 +2674,26 @@ NOINLINE HCIMPL2(Object *, JITutil_IsInstanceOfInterface, MethodTable *pInterfac
 {
     FCALL_CONTRACT;
 
+    TypeHandle::CastResult result = TypeHandle::MaybeCast;
+
     if (obj->GetMethodTable()->IsArray())
     {
-        switch (ArrayObjSupportsBizarreInterfaceNoGC(obj, pInterfaceMT)) {
-        case TypeHandle::CanCast:
-            return obj;
-        case TypeHandle::CannotCast:
-            return NULL;
-        default:
-            // fall through to the slow helper
-            break;
-        }
+        result = ArrayObjSupportsBizarreInterfaceNoGC(obj, pInterfaceMT);
+    }
+
+    if (result == TypeHandle::MaybeCast)
+    {
+        result = CastCache::TryGet(obj, TypeHandle(pInterfaceMT));
+    }
+
+    switch (result) {
+    case TypeHandle::CanCast:
+        return obj;
+    case TypeHandle::CannotCast:
+        return NULL;
+    default:
+        // fall through to the slow helper
+        break;
     }
 
     ENDFORBIDGC();
@@ -2587,6 +2714,11 @@ NOINLINE HCIMPL2(Object *, JITutil_ChkCastInterface, MethodTable *pInterfaceMT,
         }
     }
 
+    if (CastCache::TryGet(obj, TypeHandle(pInterfaceMT)) == TypeHandle::CanCast)
+    {
+        return obj;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_ChkCastAny, CORINFO_CLASS_HANDLE(pInterfaceMT), obj);
 }
@@ -3666,6 +3798,64 @@ typedef EEHashTable<const JitGenericHandleCacheKey *, JitGenericHandleCacheTrait
 JitGenericHandleCache *g_pJitGenericHandleCache = NULL;    //cache of calls to JIT_GenericHandle
 CrstStatic g_pJitGenericHandleCacheCrst;
 
+//
+// Lookups of dictionary entries that did not fit in the first bucket of their dictionary layout are not stored in the
+// dictionary and so always call the JIT_GenericHandle helpers. GenericHandleOverflowCache is a small direct-mapped
+// cache (see VersionedCache) in front of g_pJitGenericHandleCache for these, so that repeated overflow lookups from the
+// same call site are a single probe rather than a hash and a bucket chain walk.
+//
+class GenericHandleOverflowCache
+{
+    struct Key
+    {
+        TADDR m_handle;     // class or method handle the lookup was made against
+        TADDR m_signature;
+    };
+
+    static VersionedCache<Key, TADDR, 1024> s_cache;
+
+    static size_t GetHash(const Key& key)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        size_t hash = (key.m_handle >> 3) ^ ((key.m_signature >> 2) * 0x9E3779B1);
+        hash ^= hash >> 10;
+        return hash;
+    }
+
+public:
+    static BOOL TryGet(TADDR handle, LPVOID signature, CORINFO_GENERIC_HANDLE* pResult)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        Key key = { handle, (TADDR)signature };
+
+        TADDR result;
+        if (!s_cache.TryGet(GetHash(key), key, &result))
+            return FALSE;
+
+        *pResult = (CORINFO_GENERIC_HANDLE)result;
+        return TRUE;
+    }
+
+    static void TrySet(TADDR handle, LPVOID signature, CORINFO_GENERIC_HANDLE result)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        Key key = { handle, (TADDR)signature };
+        s_cache.TrySet(GetHash(key), key, (TADDR)result);
+    }
+
+    // Called with the EE suspended (see ClearJitGenericHandleCache)
+    static void Flush()
+    {
+        LIMITED_METHOD_CONTRACT;
+        s_cache.Invalidate();
+    }
+};
+
+VersionedCache<GenericHandleOverflowCache::Key, TADDR, 1024> GenericHandleOverflowCache::s_cache;
+
 void AddToGenericHandleCache(JitGenericHandleCacheKey* pKey, HashDatum datum)
 {
      CONTRACTL {
@@ -3707,6 +3897,8 @@ void ClearJitGenericHandleCache(AppDomain *pDomain)
     // enough information to do that.  However everything in the cache can be found again by calling
     // loader functions, and the total number of entries in the cache is typically very small (indeed
     // normally the cache is not used at all - it is only used when the generic dictionaries overflow).
+    GenericHandleOverflowCache::Flush();
+
     if (g_pJitGenericHandleCache)
     {
         // It's not necessary to take the lock here because this function should only be called when EE is suspended,
@@ -3876,10 +4068,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleMethod, CORINFO_METHOD_HANDLE
         PRECONDITION(CheckPointer(signature));
     } CONTRACTL_END;
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)methodHnd, signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(NULL, methodHnd, signature);
     HashDatum res;
-    if (g_pJitGenericHandleCache->GetValueSpeculative(&key,&res))
-        return (CORINFO_GENERIC_HANDLE) (DictionaryEntry) res;
+    if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)methodHnd, signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
+        return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -3896,10 +4095,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleMethodWithSlotAndModule, CORINF
         PRECONDITION(CheckPointer(pArgs));
     } CONTRACTL_END;
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)methodHnd, pArgs->signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(NULL, methodHnd, pArgs->signature);
     HashDatum res;
     if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)methodHnd, pArgs->signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
         return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -3920,10 +4126,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleMethodLogging, CORINFO_METHOD_H
 
     g_IBCLogger.LogMethodDescAccess(GetMethod(methodHnd));
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)methodHnd, signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(NULL, methodHnd, signature);
     HashDatum res;
-    if (g_pJitGenericHandleCache->GetValueSpeculative(&key,&res))
-        return (CORINFO_GENERIC_HANDLE) (DictionaryEntry) res;
+    if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)methodHnd, signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
+        return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -3942,10 +4155,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleClass, CORINFO_CLASS_HANDLE cla
         PRECONDITION(CheckPointer(signature));
     } CONTRACTL_END;
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)classHnd, signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(classHnd, NULL, signature);
     HashDatum res;
-    if (g_pJitGenericHandleCache->GetValueSpeculative(&key,&res))
-        return (CORINFO_GENERIC_HANDLE) (DictionaryEntry) res;
+    if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)classHnd, signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
+        return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -3962,10 +4182,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleClassWithSlotAndModule, CORINFO
         PRECONDITION(CheckPointer(pArgs));
     } CONTRACTL_END;
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)classHnd, pArgs->signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(classHnd, NULL, pArgs->signature);
     HashDatum res;
     if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)classHnd, pArgs->signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
         return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -3986,10 +4213,17 @@ HCIMPL2(CORINFO_GENERIC_HANDLE, JIT_GenericHandleClassLogging, CORINFO_CLASS_HAN
 
     g_IBCLogger.LogMethodTableAccess((MethodTable *)classHnd);
 
+    CORINFO_GENERIC_HANDLE result;
+    if (GenericHandleOverflowCache::TryGet((TADDR)classHnd, signature, &result))
+        return result;
+
     JitGenericHandleCacheKey key(classHnd, NULL, signature);
     HashDatum res;
-    if (g_pJitGenericHandleCache->GetValueSpeculative(&key,&res))
-        return (CORINFO_GENERIC_HANDLE) (DictionaryEntry) res;
+    if (g_pJitGenericHandleCache->GetValueSpeculative(&key, &res))
+    {
+        GenericHandleOverflowCache::TrySet((TADDR)classHnd, signature, (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res);
+        return (CORINFO_GENERIC_HANDLE)(DictionaryEntry)res;
+    }
 
     // Tailcall to the slow helper
     ENDFORBIDGC();
@@ -56,14 +56,68 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
 // shown to slow down the JIT significantly (10% or more). The memory blocks used by the JIT tend to be too big
 // to be covered by pooling done by the default malloc.
 //
-// - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads.
-// - On finalizer thread, release the extra memory that was not used recently.
+// - Keep a few memory blocks on each thread so that back-to-back compilations on the same thread
+//   (e.g. the tiering background worker, or a burst of startup compiles) do not take the lock at all.
+// - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads. The limit
+//   covers both the shared lists and the per-thread caches.
+// - On finalizer thread, release the extra memory that was not used recently, including the per-thread
+//   caches of threads that have not compiled anything recently.
 //
 
+// The owning thread takes its whole list while it looks at it, and puts it back afterwards. Anybody else
+// (reclaim, thread teardown) can only take the list, so putting it back never overwrites a list.
+JitHost::Slab* JitHost::takeThreadSlabCache(Thread* pThread)
+{
+    return (Slab*)FastInterlockExchangePointer(&pThread->m_pJitSlabCache, NULL);
+}
+
+void JitHost::putThreadSlabCache(Thread* pThread, Slab* pList)
+{
+    pThread->m_dwJitSlabCacheLastUse = ::GetTickCount();
+
+    void* pPrevious = FastInterlockExchangePointer(&pThread->m_pJitSlabCache, (void*)pList);
+    _ASSERTE(pPrevious == NULL);
+}
+
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
 
+    Thread* pCurrentThread = GetThread();
+    if (pCurrentThread != NULL && pCurrentThread->m_pJitSlabCache != NULL)
+    {
+        Slab* pList = takeThreadSlabCache(pCurrentThread);
+        Slab* pFound = NULL;
+
+        for (Slab ** ppList = &pList; *ppList != NULL; ppList = &(*ppList)->pNext)
+        {
+            Slab* p = *ppList;
+            if (p->size >= size && p->size <= 4 * size) // Avoid wasting more than 4x memory
+            {
+                *ppList = p->pNext;
+                pFound = p;
+                break;
+            }
+        }
+
+        if (pList != NULL)
+        {
+            putThreadSlabCache(pCurrentThread, pList);
+        }
+
+        if (pFound != NULL)
+        {
+            FastInterlockExchangeAdd(&m_totalThreadCached, -(LONG)pFound->size);
+            *pActualSize = pFound->size;
+            return pFound;
+        }
+    }
+
+    return allocateSharedSlab(size, pActualSize);
+}
+
+void* JitHost::allocateSharedSlab(size_t size, size_t* pActualSize)
+{
     Thread* pCurrentThread = GetThread();
     if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
     {
@@ -115,17 +169,56 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
 {
     _ASSERTE(actualSize >= sizeof(Slab));
 
+    if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
+    {
+        Thread* pCurrentThread = GetThread();
+
+        // The budget check is racy, so the limit may be overshot by a few slabs; that's fine.
+        if (pCurrentThread != NULL &&
+            m_totalCached + (size_t)VolatileLoad(&m_totalThreadCached) < g_pConfig->JitHostMaxSlabCache())
+        {
+            Slab* pList = takeThreadSlabCache(pCurrentThread);
+
+            DWORD count = 0;
+            for (Slab* p = pList; p != NULL; p = p->pNext)
+                count++;
+
+            if (count < g_pConfig->JitHostMaxThreadSlabCache())
+            {
+                Slab* pSlab = (Slab*)slab;
+                pSlab->size = actualSize;
+                pSlab->affinity = pCurrentThread;
+                pSlab->pNext = pList;
+
+                FastInterlockExchangeAdd(&m_totalThreadCached, (LONG)actualSize);
+                putThreadSlabCache(pCurrentThread, pSlab);
+                return;
+            }
+
+            if (pList != NULL)
+            {
+                putThreadSlabCache(pCurrentThread, pList);
+            }
+        }
+    }
+
+    freeSharedSlab(slab, actualSize, GetThread());
+}
+
+void JitHost::freeSharedSlab(void* slab, size_t actualSize, Thread* affinity)
+{
     if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
     {
         CrstHolder lock(&m_jitSlabAllocatorCrst);
 
-        if (m_totalCached < g_pConfig->JitHostMaxSlabCache()) // Do not cache more than maximum allowed value
+        // Do not cache more than maximum allowed value
+        if (m_totalCached + (size_t)VolatileLoad(&m_totalThreadCached) < g_pConfig->JitHostMaxSlabCache())
         {
             m_totalCached += actualSize;
 
             Slab* pSlab = (Slab*)slab;
             pSlab->size = actualSize;
-            pSlab->affinity = GetThread();
+            pSlab->affinity = affinity;
             pSlab->pNext = m_pCurrentCachedList;
             m_pCurrentCachedList = pSlab;
             return;
@@ -135,6 +228,46 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
     ClrFreeInProcessHeap(0, slab);
 }
 
+// Move the slabs cached on a thread that is going away to the shared cache.
+void JitHost::releaseThreadSlabCache(Thread* pThread)
+{
+    Slab* pSlab = takeThreadSlabCache(pThread);
+
+    while (pSlab != NULL)
+    {
+        Slab* pNext = pSlab->pNext;
+        FastInterlockExchangeAdd(&m_totalThreadCached, -(LONG)pSlab->size);
+        freeSharedSlab(pSlab, pSlab->size, NULL);
+        pSlab = pNext;
+    }
+}
+
+// Free the slabs cached on threads that have not compiled anything since the last flush.
+void JitHost::trimThreadSlabCaches(DWORD ticks)
+{
+    ThreadStoreLockHolder tsl;
+
+    Thread* pThread = NULL;
+    while ((pThread = ThreadStore::GetAllThreadList(pThread, 0, 0)) != NULL)
+    {
+        if (pThread->m_pJitSlabCache == NULL ||
+            (DWORD)(ticks - pThread->m_dwJitSlabCacheLastUse) < 2000)
+        {
+            continue;
+        }
+
+        Slab* pSlab = takeThreadSlabCache(pThread);
+
+        while (pSlab != NULL)
+        {
+            Slab* pNext = pSlab->pNext;
+            FastInterlockExchangeAdd(&m_totalThreadCached, -(LONG)pSlab->size);
+            ClrFreeInProcessHeap(0, pSlab);
+            pSlab = pNext;
+        }
+    }
+}
+
 void JitHost::init()
 {
     m_jitSlabAllocatorCrst.Init(CrstLeafLock);
@@ -142,7 +275,7 @@ void JitHost::init()
 
 void JitHost::reclaim()
 {
-    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
+    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL || VolatileLoad(&m_totalThreadCached) != 0)
     {
         DWORD ticks = ::GetTickCount();
 
@@ -156,6 +289,11 @@ void JitHost::reclaim()
             return;
         m_lastFlush = ticks;
 
+        if (VolatileLoad(&m_totalThreadCached) != 0)
+        {
+            trimThreadSlabCaches(ticks);
+        }
+
         // Flush all slabs in m_pPreviousCachedList
         for (;;)
         {
@@ -22,6 +22,7 @@ private:
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
     size_t m_totalCached;
+    LONG m_totalThreadCached;  // Bytes cached on threads; counts against the same JitHostMaxSlabCache budget
     DWORD m_lastFlush;
 
     JitHost() {}
@@ -30,6 +31,12 @@ private:
 
     void init();
     void reclaim();
+    void releaseThreadSlabCache(Thread* pThread);
+    void trimThreadSlabCaches(DWORD ticks);
+    Slab* takeThreadSlabCache(Thread* pThread);
+    void putThreadSlabCache(Thread* pThread, Slab* pList);
+    void* allocateSharedSlab(size_t size, size_t* pActualSize);
+    void freeSharedSlab(void* slab, size_t actualSize, Thread* affinity);
 
 public:
     virtual void* allocateMemory(size_t size);
@@ -42,6 +49,7 @@ public:
 
     static void Init() { s_theJitHost.init(); }
     static void Reclaim() { s_theJitHost.reclaim(); }
+    static void ReleaseThreadSlabCache(Thread* pThread) { s_theJitHost.releaseThreadSlabCache(pThread); }
 
     static ICorJitHost* getJitHost() { return &s_theJitHost; }
 };
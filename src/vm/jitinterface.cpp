@@ -11266,6 +11266,12 @@ void reservePersonalityRoutineSpace(ULONG &unwindSize)
 #endif // !defined(_TARGET_AMD64_)
 
 }
+
+#ifdef _TARGET_AMD64_
+// Size of the unwind info describing the cold section of a split method: an UNWIND_INFO
+// header without unwind codes, followed by the RUNTIME_FUNCTION of the main method.
+static const ULONG ChainedUnwindInfoSize = offsetof(UNWIND_INFO, UnwindCode) + sizeof(T_RUNTIME_FUNCTION);
+#endif // _TARGET_AMD64_
 // Reserve memory for the method/funclet's unwind information.
 // Note that this must be called before allocMem. It should be
 // called once for the main method, once for every funclet, and
@@ -11289,7 +11295,6 @@ void CEEJitInfo::reserveUnwindInfo(BOOL isFunclet, BOOL isColdCode, ULONG unwind
 
     JIT_TO_EE_TRANSITION_LEAF();
 
-    CONSISTENCY_CHECK_MSG(!isColdCode, "Hot/Cold splitting is not supported in jitted code");
     _ASSERTE_MSG(m_theUnwindBlock == NULL,
         "reserveUnwindInfo() can only be called before allocMem(), but allocMem() has already been called. "
         "This may indicate the JIT has hit a NO_WAY assert after calling allocMem(), and is re-JITting. "
@@ -11297,7 +11302,21 @@ void CEEJitInfo::reserveUnwindInfo(BOOL isFunclet, BOOL isColdCode, ULONG unwind
 
     ULONG currentSize  = unwindSize;
 
-    reservePersonalityRoutineSpace(currentSize);
+#ifdef _TARGET_AMD64_
+    if (isColdCode)
+    {
+        // The JIT does not produce unwind codes for the cold section. We describe it with
+        // chained unwind info that refers back to the main method (see allocUnwindInfo).
+        _ASSERTE(!isFunclet);
+        currentSize = ChainedUnwindInfoSize;
+    }
+    else
+#else // !_TARGET_AMD64_
+    CONSISTENCY_CHECK_MSG(!isColdCode, "Hot/Cold splitting is not supported in jitted code");
+#endif // !_TARGET_AMD64_
+    {
+        reservePersonalityRoutineSpace(currentSize);
+    }
 
     m_totalUnwindSize += currentSize;
 
@@ -11323,9 +11342,10 @@ void CEEJitInfo::reserveUnwindInfo(BOOL isFunclet, BOOL isColdCode, ULONG unwind
 // Parameters:
 //
 //    pHotCode        main method code buffer, always filled in
-//    pColdCode       always NULL for jitted code
-//    startOffset     start of code block, relative to pHotCode
-//    endOffset       end of code block, relative to pHotCode
+//    pColdCode       cold code buffer when reporting the cold section of a split
+//                    method (AMD64 only), otherwise NULL
+//    startOffset     start of code block, relative to pHotCode (or pColdCode)
+//    endOffset       end of code block, relative to pHotCode (or pColdCode)
 //    unwindSize      size of unwind info pointed to by pUnwindBlock
 //    pUnwindBlock    pointer to unwind info
 //    funcKind        type of funclet (main method code, handler, filter)
@@ -11351,7 +11371,9 @@ void CEEJitInfo::allocUnwindInfo (
         PRECONDITION(endOffset <= m_codeSize);
     } CONTRACTL_END;
 
+#ifndef _TARGET_AMD64_
     CONSISTENCY_CHECK_MSG(pColdCode == NULL, "Hot/Cold code splitting not supported for jitted code");
+#endif // !_TARGET_AMD64_
 
     JIT_TO_EE_TRANSITION();
 
@@ -11379,9 +11401,25 @@ void CEEJitInfo::allocUnwindInfo (
     _ASSERTE(IS_ALIGNED(pRuntimeFunction, sizeof(DWORD)));
 
     UNWIND_INFO * pUnwindInfo = (UNWIND_INFO *) &(m_theUnwindBlock[m_usedUnwindSize]);
-    m_usedUnwindSize += unwindSize;
 
-    reservePersonalityRoutineSpace(m_usedUnwindSize);
+#ifdef _TARGET_AMD64_
+    if (pColdCode != NULL)
+    {
+        // Cold code of the main method. The hot part has been reported already, and
+        // the unwind info for the cold part is chained to it; see reserveUnwindInfo.
+        _ASSERTE(funcKind == CORJIT_FUNC_ROOT);
+        _ASSERTE(unwindSize == 0);
+        _ASSERTE(m_usedUnwindInfos > 1);
+
+        m_usedUnwindSize += ChainedUnwindInfoSize;
+    }
+    else
+#endif // _TARGET_AMD64_
+    {
+        m_usedUnwindSize += unwindSize;
+
+        reservePersonalityRoutineSpace(m_usedUnwindSize);
+    }
 
     _ASSERTE(m_usedUnwindSize <= m_totalUnwindSize);
 
@@ -11392,7 +11430,7 @@ void CEEJitInfo::allocUnwindInfo (
 
     TADDR baseAddress = m_moduleBase;
 
-    size_t currentCodeSizeT = (size_t)pHotCode - baseAddress;
+    size_t currentCodeSizeT = (size_t)((pColdCode != NULL) ? pColdCode : pHotCode) - baseAddress;
 
     /* Check if currentCodeSizeT offset fits in 32-bits */
     if (!FitsInU4(currentCodeSizeT))
@@ -11444,8 +11482,25 @@ void CEEJitInfo::allocUnwindInfo (
     }
 #endif // _DEBUG
 
-    /* Copy the UnwindBlock */
-    memcpy(pUnwindInfo, pUnwindBlock, unwindSize);
+#ifdef _TARGET_AMD64_
+    if (pColdCode != NULL)
+    {
+        // The cold section runs in the frame set up by the main method's prolog, so
+        // unwinding it is the same as unwinding the main body after its prolog.
+        // The personality routine is found through the chained (primary) entry.
+        memset(pUnwindInfo, 0, offsetof(UNWIND_INFO, UnwindCode));
+        pUnwindInfo->Version = 1;
+        pUnwindInfo->Flags   = UNW_FLAG_CHAININFO;
+
+        PT_RUNTIME_FUNCTION pChainedFunction = (PT_RUNTIME_FUNCTION)&(pUnwindInfo->UnwindCode[0]);
+        *pChainedFunction = *m_CodeHeader->GetUnwindInfo(0);
+    }
+    else
+#endif // _TARGET_AMD64_
+    {
+        /* Copy the UnwindBlock */
+        memcpy(pUnwindInfo, pUnwindBlock, unwindSize);
+    }
 
 #if defined(_TARGET_X86_)
 
@@ -11453,10 +11508,13 @@ void CEEJitInfo::allocUnwindInfo (
 
 #elif defined(_TARGET_AMD64_)
 
-    pUnwindInfo->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
+    if (pColdCode == NULL)
+    {
+        pUnwindInfo->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
 
-    ULONG * pPersonalityRoutine = (ULONG*)ALIGN_UP(&(pUnwindInfo->UnwindCode[pUnwindInfo->CountOfUnwindCodes]), sizeof(ULONG));
-    *pPersonalityRoutine = ExecutionManager::GetCLRPersonalityRoutineValue();
+        ULONG * pPersonalityRoutine = (ULONG*)ALIGN_UP(&(pUnwindInfo->UnwindCode[pUnwindInfo->CountOfUnwindCodes]), sizeof(ULONG));
+        *pPersonalityRoutine = ExecutionManager::GetCLRPersonalityRoutineValue();
+    }
 
 #elif defined(_TARGET_ARM64_)
 
@@ -12076,7 +12134,27 @@ void CEEJitInfo::allocMem (
 
     JIT_TO_EE_TRANSITION();
 
+#ifdef _TARGET_AMD64_
+    // The cold section of a split method is allocated separately, in the cold code region of
+    // the code heap that the hot section is allocated in (see EEJitManager::allocCode). The JIT
+    // reports GC info, EH clauses and debug info with cold code offsets that continue from the
+    // end of the hot code; the code manager maps them to the cold section using the hot code
+    // size recorded in the code header.
+    //
+    // Dynamic methods free their code as a single block, so their cold section is placed
+    // directly after the hot section instead, where the same offsets are valid as they are.
+    bool separateColdCode = (coldCodeSize > 0) && !m_pMethodBeingCompiled->IsLCGMethod();
+
+    S_SIZE_T totalSize = S_SIZE_T(hotCodeSize);
+    if (!separateColdCode)
+    {
+        totalSize += S_SIZE_T(coldCodeSize);
+    }
+#else // !_TARGET_AMD64_
     _ASSERTE(coldCodeSize == 0);
+    S_SIZE_T totalSize = S_SIZE_T(hotCodeSize);
+#endif // !_TARGET_AMD64_
+
     if (coldCodeBlock)
     {
         *coldCodeBlock = NULL;
@@ -12085,8 +12163,6 @@ void CEEJitInfo::allocMem (
     ULONG codeSize      = hotCodeSize;
     void **codeBlock    = hotCodeBlock;
 
-    S_SIZE_T totalSize = S_SIZE_T(codeSize);
-
     size_t roDataAlignment = sizeof(void*);
     if ((flag & CORJIT_ALLOCMEM_FLG_RODATA_16BYTE_ALIGN)!= 0)
     {
@@ -12126,10 +12202,19 @@ void CEEJitInfo::allocMem (
         COMPlusThrowHR(CORJIT_OUTOFMEM);
     }
 
+#ifdef _TARGET_AMD64_
+    TADDR pColdCode = NULL;
+#endif
+
     m_CodeHeader = m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), flag
 #ifdef FEATURE_EH_FUNCLETS
                                            , m_totalUnwindInfos
                                            , &m_moduleBase
+#endif
+#ifdef _TARGET_AMD64_
+                                           , hotCodeSize
+                                           , separateColdCode ? coldCodeSize : 0
+                                           , &pColdCode
 #endif
                                            );
 
@@ -12138,6 +12223,23 @@ void CEEJitInfo::allocMem (
     *codeBlock = current;
     current += codeSize;
 
+    if (coldCodeSize > 0)
+    {
+        _ASSERTE(coldCodeBlock != NULL);
+#ifdef _TARGET_AMD64_
+        if (separateColdCode)
+        {
+            _ASSERTE(pColdCode != NULL);
+            *coldCodeBlock = (BYTE *)pColdCode;
+        }
+        else
+#endif
+        {
+            *coldCodeBlock = current;
+            current += coldCodeSize;
+        }
+    }
+
     if (roDataSize > 0)
     {
         current = (BYTE *)ALIGN_UP(current, roDataAlignment);
@@ -12159,7 +12261,7 @@ void CEEJitInfo::allocMem (
     _ASSERTE((SIZE_T)(current - (BYTE *)m_CodeHeader->GetCodeStartAddress()) <= totalSize.Value());
 
 #ifdef _DEBUG
-    m_codeSize = codeSize;
+    m_codeSize = codeSize + coldCodeSize;
 #endif  // _DEBUG
 
     EE_TO_JIT_TRANSITION();
@@ -12722,6 +12824,18 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_PROF_NO_PINVOKE_INLINE);
 #endif // PROFILING_SUPPORTED
 
+#ifdef _TARGET_AMD64_
+    // Let the jit move rarely run code into a cold section, which is allocated in a separate
+    // region of the code heap; see EEJitManager::allocCode. Minopts and tier0 code has no
+    // block weights worth splitting on.
+    if (g_pConfig->JitHotColdSplitting() &&
+        !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_MIN_OPT) && !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) &&
+        !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_CODE))
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_PROCSPLIT);
+    }
+#endif // _TARGET_AMD64_
+
     // Set optimization flags
     if (!flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_MIN_OPT))
     {
@@ -12744,6 +12858,17 @@ CORJIT_FLAGS GetCompileFlags(MethodDesc * ftn, CORJIT_FLAGS flags, CORINFO_METHO
         }
     }
 
+#ifdef FEATURE_ENABLE_GCPOLL
+    // In tier-1 polling mode only optimized code polls; the polls are cheap there and let suspension
+    // complete without hijacking. Tier-0 and debuggable code is left to the hijack/redirect path.
+    if ((g_pConfig->GetGCPollType() == EEConfig::GCPOLL_TYPE_TIER1) &&
+        !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_MIN_OPT) && !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0) &&
+        !flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_CODE))
+    {
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_GCPOLL_INLINE);
+    }
+#endif // FEATURE_ENABLE_GCPOLL
+
     flags.Set(CORJIT_FLAGS::CORJIT_FLAG_SKIP_VERIFICATION);
 
     if (ftn->IsILStub() && !g_pConfig->GetTrackDynamicMethodDebugInfo())
@@ -14437,8 +14562,18 @@ void EECodeInfo::GetOffsetsFromUnwindInfo(ULONG* pRSPOffset, ULONG* pRBPOffset)
     UNWIND_INFO * pInfo = GetUnwindInfoHelper(unwindInfo);
     if (pInfo->Flags & UNW_FLAG_CHAININFO)
     {
-        _ASSERTE(!"GetRbpOffset() - chained unwind info used, violating assumptions of the security stackwalk cache");
-        DebugBreak();
+        // The cold section of a split method carries no unwind codes of its own and is
+        // chained to the main method, whose frame it runs in.
+        _ASSERTE(pInfo->CountOfUnwindCodes == 0);
+        PTR_RUNTIME_FUNCTION pChainedFunction = PTR_RUNTIME_FUNCTION(moduleBase + unwindInfo + offsetof(UNWIND_INFO, UnwindCode));
+        unwindInfo = RUNTIME_FUNCTION__GetUnwindInfoAddress(pChainedFunction);
+        pInfo = GetUnwindInfoHelper(unwindInfo);
+
+        if (pInfo->Flags & UNW_FLAG_CHAININFO)
+        {
+            _ASSERTE(!"GetRbpOffset() - nested chained unwind info used, violating assumptions of the security stackwalk cache");
+            DebugBreak();
+        }
     }
 
     // Either we are not using a frame pointer, or we are using rbp as the frame pointer.
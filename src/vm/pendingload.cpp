@@ -71,7 +71,7 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::AllocNewEntry()
     CONTRACTL_END
 
 #ifdef _DEBUG
-    m_dwDebugMemory += (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    FastInterlockExchangeAdd((LONG*)&m_dwDebugMemory, (LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 
     return (PendingTypeLoadTable::TableEntry *) new (nothrow) BYTE[sizeof(PendingTypeLoadTable::TableEntry)];
@@ -92,7 +92,7 @@ void PendingTypeLoadTable::FreeEntry(PendingTypeLoadTable::TableEntry * pEntry)
     delete[] ((BYTE*)pEntry);
 
 #ifdef _DEBUG
-    m_dwDebugMemory -= (DWORD) (sizeof(PendingTypeLoadTable::TableEntry));
+    FastInterlockExchangeAdd((LONG*)&m_dwDebugMemory, -(LONG)sizeof(PendingTypeLoadTable::TableEntry));
 #endif
 }
 
@@ -200,8 +200,33 @@ PendingTypeLoadTable::TableEntry *PendingTypeLoadTable::FindItem(TypeKey *pKey)
 }
 
 
+//
+// Returns the lock stripe that guards the bucket pKey hashes to. A stripe owns every bucket whose index
+// is congruent to it modulo dwNumStripes, so a key always maps to the same stripe and no bucket is
+// shared between stripes.
+//
+DWORD PendingTypeLoadTable::GetStripe(TypeKey *pKey, DWORD dwNumStripes)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        FORBID_FAULT;
+        PRECONDITION(CheckPointer(pKey));
+        PRECONDITION(dwNumStripes != 0);
+    }
+    CONTRACTL_END
+
+    _ASSERTE(m_dwNumBuckets != 0);
+
+    DWORD dwBucket = pKey->ComputeHash() % m_dwNumBuckets;
+    return dwBucket % dwNumStripes;
+}
+
+
 #ifdef _DEBUG
-void PendingTypeLoadTable::Dump()
+void PendingTypeLoadTable::Dump(DWORD dwStripe, DWORD dwNumStripes)
 {
     CONTRACTL
     {
@@ -211,8 +236,12 @@ void PendingTypeLoadTable::Dump()
     }
     CONTRACTL_END
 
-    LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
-    for (DWORD i = 0; i < m_dwNumBuckets; i++)
+    if (dwStripe == 0)
+    {
+        LOG((LF_CLASSLOADER, LL_INFO10000, "PHASEDLOAD: table contains:\n"));
+    }
+
+    for (DWORD i = dwStripe; i < m_dwNumBuckets; i += dwNumStripes)
     {
         for (TableEntry *pSearch = m_pBuckets[i]; pSearch; pSearch = pSearch->pNext)
         {
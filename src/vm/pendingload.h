@@ -218,6 +218,10 @@ public:
 
 // Hash table used to hold pending type loads
 // @todo : use shash.h when it supports LoaderHeap/Alloc\MemTracker
+//
+// The table has no lock of its own. Callers partition the buckets into stripes (see GetStripe) and must
+// hold the lock for a key's stripe while operating on that key; buckets in different stripes may be
+// accessed concurrently.
 class PendingTypeLoadTable
 {
 protected:
@@ -251,10 +255,11 @@ public:
     BOOL            InsertValue(PendingTypeLoadEntry* pEntry);
     BOOL            DeleteValue(TypeKey *pKey);
     PendingTypeLoadEntry* GetValue(TypeKey *pKey);
+    DWORD           GetStripe(TypeKey *pKey, DWORD dwNumStripes);
     TableEntry* AllocNewEntry();
     void FreeEntry(TableEntry* pEntry);
 #ifdef _DEBUG
-    void            Dump();
+    void            Dump(DWORD dwStripe, DWORD dwNumStripes);
 #endif
 
 private:
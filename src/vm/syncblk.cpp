@@ -565,6 +565,10 @@ void SyncBlockCache::CleanupSyncBlocks()
     // IMPORTANT: This must be set before the sync block cleanup bit is reset on the thread.
     m_bSyncBlockCleanupInProgress = TRUE;
 
+    // Destructed sync blocks are returned to the free pool in batches, so the finalizer thread does not contend with
+    // threads allocating sync blocks for the cache lock once per block.
+    const DWORD FreeBatchSize = 64;
+
     struct Param
     {
         SyncBlockCache *pThis;
@@ -572,12 +576,18 @@ void SyncBlockCache::CleanupSyncBlocks()
 #ifdef FEATURE_COMINTEROP
         RCW* pRCW;
 #endif
+        SLink* pFreeHead;
+        SLink* pFreeTail;
+        DWORD freeCount;
     } param;
     param.pThis = this;
     param.psb = NULL;
 #ifdef FEATURE_COMINTEROP
     param.pRCW = NULL;
 #endif
+    param.pFreeHead = NULL;
+    param.pFreeTail = NULL;
+    param.freeCount = 0;
 
     EE_TRY_FOR_FINALLY(Param *, pParam, &param)
     {
@@ -606,10 +616,26 @@ void SyncBlockCache::CleanupSyncBlocks()
             }
 #endif // FEATURE_COMINTEROP
 
-            // Delete the sync block.
-            pParam->pThis->DeleteSyncBlock(pParam->psb);
+            // Delete the sync block, deferring the return of its memory to the free pool.
+            pParam->pThis->DestructSyncBlock(pParam->psb);
+
+            SLink *pLink = &pParam->psb->m_Link;
+            pLink->m_pNext = pParam->pFreeHead;
+            pParam->pFreeHead = pLink;
+            if (pParam->pFreeTail == NULL)
+            {
+                pParam->pFreeTail = pLink;
+            }
             pParam->psb = NULL;
 
+            if (++pParam->freeCount >= FreeBatchSize)
+            {
+                pParam->pThis->DeleteSyncBlockMemoryList(pParam->pFreeHead, pParam->pFreeTail, pParam->freeCount);
+                pParam->pFreeHead = NULL;
+                pParam->pFreeTail = NULL;
+                pParam->freeCount = 0;
+            }
+
             // pulse GC mode to allow GC to perform its work
             if (FinalizerThread::GetFinalizerThread()->CatchAtSafePointOpportunistic())
             {
@@ -635,6 +661,9 @@ void SyncBlockCache::CleanupSyncBlocks()
 
         if (param.psb)
             DeleteSyncBlock(param.psb);
+
+        if (param.freeCount != 0)
+            DeleteSyncBlockMemoryList(param.pFreeHead, param.pFreeTail, param.freeCount);
     } EE_END_FINALLY;
 }
 
@@ -986,6 +1015,31 @@ void SyncBlockCache::DeleteSyncBlock(SyncBlock *psb)
     }
     CONTRACTL_END;
 
+    DestructSyncBlock(psb);
+
+    //synchronizer with the consumers,
+    // <TODO>@todo we don't really need a lock here, we can come up
+    // with some simple algo to avoid taking a lock </TODO>
+    {
+        SyncBlockCache::LockHolder lh(this);
+
+        DeleteSyncBlockMemory(psb);
+    }
+}
+
+// clean up and destruct a used sync block without returning its memory to the free pool
+void SyncBlockCache::DestructSyncBlock(SyncBlock *psb)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM());
+    }
+    CONTRACTL_END;
+
     // clean up comdata
     if (psb->m_pInteropInfo)
     {
@@ -1017,15 +1071,6 @@ void SyncBlockCache::DeleteSyncBlock(SyncBlock *psb)
     // Destruct the SyncBlock, but don't reclaim its memory.  (Overridden
     // operator delete).
     delete psb;
-
-    //synchronizer with the consumers,
-    // <TODO>@todo we don't really need a lock here, we can come up
-    // with some simple algo to avoid taking a lock </TODO>
-    {
-        SyncBlockCache::LockHolder lh(this);
-
-        DeleteSyncBlockMemory(psb);
-    }
 }
 
 
@@ -1049,6 +1094,28 @@ void    SyncBlockCache::DeleteSyncBlockMemory(SyncBlock *psb)
 
 }
 
+// returns a list of destructed sync blocks to the free pool (takes the cache lock)
+void    SyncBlockCache::DeleteSyncBlockMemoryList(SLink *pHead, SLink *pTail, DWORD count)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(pHead != NULL && pTail != NULL && count != 0);
+    }
+    CONTRACTL_END
+
+    SyncBlockCache::LockHolder lh(this);
+
+    m_ActiveCount -= count;
+    m_FreeCount += count;
+
+    pTail->m_pNext = m_FreeBlockList;
+    m_FreeBlockList = pHead;
+}
+
 // free a used sync block
 void SyncBlockCache::GCDeleteSyncBlock(SyncBlock *psb)
 {
@@ -1623,15 +1690,18 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Spin only for as long as has recently been useful for this particular lock
+            const DWORD lockSpinCount = awareLock->GetSpinCount();
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1640,6 +1710,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true, spinIteration);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1649,7 +1720,15 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 }
             }
 
-            if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
+            bool acquiredLock = awareLock->TryEnterAfterSpinLoopHelper(pCurThread);
+
+            // Stopping early to avoid preempting waiters says nothing about how long the lock is held
+            if (acquiredLock || result != AwareLock::EnterHelperResult_UseSlowPath)
+            {
+                awareLock->RecordSpinResult(acquiredLock, spinIteration);
+            }
+
+            if (acquiredLock)
             {
                 return AwareLock::EnterHelperResult_Entered;
             }
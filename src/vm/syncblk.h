@@ -445,7 +445,21 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // Number of spin iterations a contending thread currently performs before waiting on this lock. Starts at
+    // g_SpinConstants.dwMonitorSpinCount and is adjusted by RecordSpinResult() based on whether spinning has recently been
+    // successful in acquiring this lock. Updates are racy, the value is only a hint.
+    DWORD m_spinCount;
+
+    // Number of consecutive failed spins since the spin count decayed to its minimum. Once it reaches
+    // FailedSpinsAtMinimumBeforeProbe, the next contending thread probes with the full configured spin count, so that a lock
+    // whose hold time has become short again can regain its spin budget.
+    DWORD m_failedSpinsAtMinimum;
+    bool m_isProbingSpinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const DWORD MinimumSpinCount = 4;
+    static const DWORD SpinCountIncrementOnSuccess = 2;
+    static const DWORD FailedSpinsAtMinimumBeforeProbe = 64;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -456,7 +470,10 @@ private:
 #endif // DACCESS_COMPILE          
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount),
+          m_failedSpinsAtMinimum(0),
+          m_isProbingSpinCount(false)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -534,6 +551,9 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock, DWORD spinIteration);
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
@@ -1207,9 +1227,15 @@ class SyncBlockCache
     // return sync block to cache or delete
     void    DeleteSyncBlock(SyncBlock *sb);
 
+    // cleans up and destructs the sync block, but does not return its memory to the free pool
+    void    DestructSyncBlock(SyncBlock *sb);
+
     // returns the sync block memory to the free pool but does not destruct sync block (must own cache lock already)
     void    DeleteSyncBlockMemory(SyncBlock *sb);
 
+    // returns a list of destructed sync blocks, linked through m_Link, to the free pool under a single lock acquisition
+    void    DeleteSyncBlockMemoryList(SLink *pHead, SLink *pTail, DWORD count);
+
     // return sync block to cache or delete, called from GC
     void    GCDeleteSyncBlock(SyncBlock *sb);
 
@@ -468,6 +468,64 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The configured spin count may be lowered after this lock was created, it is always the upper bound
+    return min(VolatileLoadWithoutBarrier(&m_spinCount), g_SpinConstants.dwMonitorSpinCount);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock, DWORD spinIteration)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    const DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    const DWORD minSpinCount = min(MinimumSpinCount, maxSpinCount);
+    const DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    DWORD newSpinCount;
+
+    if (acquiredLock)
+    {
+        // The lock was released within spinIteration spins. Make sure the next contending thread spins a little longer than
+        // that (each spin iteration backs off exponentially, so a couple of extra iterations covers a fair bit of variance in
+        // the lock's hold time).
+        newSpinCount = min(max(spinCount, spinIteration + SpinCountIncrementOnSuccess), maxSpinCount);
+        m_isProbingSpinCount = false;
+        m_failedSpinsAtMinimum = 0;
+    }
+    else if (m_isProbingSpinCount)
+    {
+        // A probe with the full spin count did not pay off either, go straight back to the minimum
+        newSpinCount = minSpinCount;
+        m_isProbingSpinCount = false;
+    }
+    else if (spinCount > minSpinCount)
+    {
+        // Spinning did not pay off, the lock is typically held for longer than it's worth spinning. Back off gradually so that
+        // an occasional long hold does not immediately stop spinning on a lock that is usually held briefly.
+        newSpinCount = max(spinCount - spinCount / 4, minSpinCount);
+    }
+    else
+    {
+        // At the minimum, a spin only succeeds if the lock is released within a few iterations, so the spin count could not
+        // grow again even if the lock's hold time became short. Periodically let one contending thread spin for the full
+        // count to find out.
+        newSpinCount = spinCount;
+        if (++m_failedSpinsAtMinimum >= FailedSpinsAtMinimumBeforeProbe)
+        {
+            newSpinCount = maxSpinCount;
+            m_isProbingSpinCount = true;
+            m_failedSpinsAtMinimum = 0;
+        }
+    }
+
+    if (newSpinCount != spinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, newSpinCount);
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
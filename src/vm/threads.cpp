@@ -26,6 +26,7 @@
 #include "corhost.h"
 #include "win32threadpool.h"
 #include "jitinterface.h"
+#include "jithost.h"
 #include "eventtrace.h"
 #include "comutilnative.h"
 #include "finalizerthread.h"
@@ -60,24 +61,6 @@ SPTR_IMPL(ThreadStore, ThreadStore, s_pThreadStore);
 CONTEXT *ThreadStore::s_pOSContext = NULL;
 CLREvent *ThreadStore::s_pWaitForStackCrawlEvent;
 
-PTR_ThreadLocalModule ThreadLocalBlock::GetTLMIfExists(ModuleIndex index)
-{
-    WRAPPER_NO_CONTRACT;
-    SUPPORTS_DAC;
-
-    if (index.m_dwIndex >= m_TLMTableSize)
-        return NULL;
-
-    return m_pTLMTable[index.m_dwIndex].pTLM;
-}
-
-PTR_ThreadLocalModule ThreadLocalBlock::GetTLMIfExists(MethodTable* pMT)
-{
-    WRAPPER_NO_CONTRACT;
-    ModuleIndex index = pMT->GetModuleForStatics()->GetModuleIndex();
-    return GetTLMIfExists(index);
-}
-
 #ifndef DACCESS_COMPILE
 
 BOOL Thread::s_fCleanFinalizedThread = FALSE;
@@ -1576,6 +1559,9 @@ Thread::Thread()
 
     m_pAllLoggedTypes = NULL;
 
+    m_pJitSlabCache = NULL;
+    m_dwJitSlabCacheLastUse = 0;
+
 #ifdef FEATURE_PERFTRACING
     memset(&m_activityId, 0, sizeof(m_activityId));
 #endif // FEATURE_PERFTRACING
@@ -2681,6 +2667,9 @@ Thread::~Thread()
     }
 #endif // FEATURE_EVENT_TRACE
 
+    // Release any slabs kept warm for the JIT if the thread did not terminate normally
+    JitHost::ReleaseThreadSlabCache(this);
+
     // Wait for another thread to leave its loop in DeadlockAwareLock::TryBeginEnterLock
     CrstHolder lock(&g_DeadlockAwareCrst);
 }
@@ -2959,6 +2948,9 @@ void Thread::OnThreadTerminate(BOOL holdingLock)
 
     }
 
+    // Hand the slabs kept warm for the JIT on this thread back to the shared cache
+    JitHost::ReleaseThreadSlabCache(this);
+
     if  (GCHeapUtilities::IsGCHeapInitialized())
     {
         // Guaranteed to NOT be a shutdown case, because we tear down the heap before
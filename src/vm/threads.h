@@ -4910,6 +4910,14 @@ private:
     // Per thread table used to implement allocation sampling.
 	AllLoggedTypes * m_pAllLoggedTypes;
 
+private:
+    friend class JitHost;
+
+    // Slabs kept warm for the JIT by this thread. The list is always taken and put back with an
+    // interlocked exchange so that JitHost::Reclaim can steal it from a thread that stopped compiling.
+    void * volatile m_pJitSlabCache;
+    DWORD           m_dwJitSlabCacheLastUse;
+
 public:
     AllLoggedTypes * GetAllocationSamplingTable()
     {
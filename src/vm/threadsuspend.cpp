@@ -59,6 +59,10 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+// With COMPlus_GCPollType=4 optimized code polls g_TrapReturningThreads at back edges and returns. How many
+// times the suspending thread yields, waiting for such threads to reach a poll, before signaling the rest.
+#define GCPOLL_RENDEZVOUS_YIELD_COUNT   8
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -3898,7 +3902,17 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     //
     // Later we will make more passes where we do roughly the same thing.  We should combine the two loops.
     //
-    
+
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+    // Raising the suspension signal costs a signal delivery per running thread. When optimized code polls
+    // for suspension, most threads in cooperative mode will rendezvous on their own shortly, so only
+    // signal the ones that haven't after a brief wait.
+    bool fDeferSuspensionSignals = false;
+#ifdef FEATURE_ENABLE_GCPOLL
+    fDeferSuspensionSignals = (g_pConfig->GetGCPollType() == EEConfig::GCPOLL_TYPE_TIER1);
+#endif // FEATURE_ENABLE_GCPOLL
+#endif // FEATURE_HIJACK && PLATFORM_UNIX
+
     while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
     {
         if (thread->HasThreadState(Thread::TS_GCSuspendPending))
@@ -3946,10 +3960,13 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
                 countThreads++;
 
 #if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
-                bool gcSuspensionSignalSuccess = thread->InjectGcSuspension();
-                if (!gcSuspensionSignalSuccess)
+                if (!fDeferSuspensionSignals)
                 {
-                    STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime() -   Failed to raise GC suspension signal for thread %p.\n", thread);
+                    bool gcSuspensionSignalSuccess = thread->InjectGcSuspension();
+                    if (!gcSuspensionSignalSuccess)
+                    {
+                        STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime() -   Failed to raise GC suspension signal for thread %p.\n", thread);
+                    }
                 }
 #endif // FEATURE_HIJACK && PLATFORM_UNIX
             }
@@ -4068,6 +4085,54 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         }
     }
 
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+    if (fDeferSuspensionSignals && (countThreads != 0))
+    {
+        for (DWORD dwSwitchCount = 0; dwSwitchCount < GCPOLL_RENDEZVOUS_YIELD_COUNT; dwSwitchCount++)
+        {
+            BOOL fAllRendezvoused = TRUE;
+
+            _ASSERTE (thread == NULL);
+            while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+            {
+                if ((thread != pCurThread) &&
+                    ((thread->m_State & Thread::TS_GCSuspendPending) != 0) &&
+                    thread->m_fPreemptiveGCDisabled)
+                {
+                    fAllRendezvoused = FALSE;
+                    thread = NULL;
+                    break;
+                }
+            }
+
+            if (fAllRendezvoused)
+                break;
+
+            __SwitchToThread(0, CALLER_LIMITS_SPINNING);
+        }
+
+        // Whoever is left is running code without polls (tier-0 code, the VM in cooperative mode, ...).
+        _ASSERTE (thread == NULL);
+        while ((thread = ThreadStore::GetThreadList(thread)) != NULL)
+        {
+            if (thread == pCurThread)
+                continue;
+
+            if ((thread->m_State & Thread::TS_GCSuspendPending) == 0)
+                continue;
+
+            if (!thread->m_fPreemptiveGCDisabled)
+                continue;
+
+            bool gcSuspensionSignalSuccess = thread->InjectGcSuspension();
+            if (!gcSuspensionSignalSuccess)
+            {
+                STRESS_LOG1(LF_SYNC, LL_INFO1000, "Thread::SuspendRuntime() -   Failed to raise GC suspension signal for thread %p.\n", thread);
+            }
+        }
+    }
+#endif // FEATURE_HIJACK && PLATFORM_UNIX
+
 #ifdef _DEBUG
 
     {
@@ -6204,7 +6269,8 @@ BOOL Thread::HandledJITCase(BOOL ForTaskSwitchIn)
             // COMPlus_GCPollType = 1 is the setting that enables hijacking
             // in GCPOLL enabled builds.
             EEConfig::GCPollType pollType = g_pConfig->GetGCPollType();
-            if (EEConfig::GCPOLL_TYPE_HIJACK == pollType || EEConfig::GCPOLL_TYPE_DEFAULT == pollType)
+            if (EEConfig::GCPOLL_TYPE_HIJACK == pollType || EEConfig::GCPOLL_TYPE_DEFAULT == pollType ||
+                EEConfig::GCPOLL_TYPE_TIER1 == pollType)
 #endif // FEATURE_ENABLE_GCPOLL
             {
                 HijackThread(pvHijackAddr, &esb);
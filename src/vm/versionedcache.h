@@ -0,0 +1,149 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+// File: versionedcache.h
+//
+
+//
+// VersionedCache is a small, fixed-size, direct-mapped cache that can be read and written
+// without taking a lock. It is meant to sit in front of a slower lookup (a hash table, a
+// nibble map, a list walk) whose answers are expensive to recompute but cheap to remember.
+//
+// Each entry carries a version: a writer makes it odd while it updates the entry and even
+// again when it is done, and a reader only trusts an entry whose version was even and
+// unchanged while it read the key and the value. A writer that finds the entry busy simply
+// doesn't cache its result. Keys and values are read and written one pointer-sized word at
+// a time with VolatileLoad, which keeps the reads ordered between the two version checks.
+//
+// Each entry also records the cache's epoch at the time the answer was computed. Bumping the
+// epoch (Invalidate) makes every entry stale at once, for caches whose answers can become
+// wrong. Callers that sample the epoch before doing the slow lookup and pass it to TrySet
+// never store an answer that raced with an invalidation as current.
+//
+// KEY and VALUE must be plain structs (or scalars) made of pointer-sized fields, with no
+// padding, since they are compared and copied word by word. Instances are expected to be
+// statics, so there's no constructor: the zero-initialized table is empty.
+//
+
+#ifndef __VERSIONEDCACHE_H__
+#define __VERSIONEDCACHE_H__
+
+template <typename KEY, typename VALUE, DWORD TABLE_SIZE>
+class VersionedCache
+{
+    static_assert_no_msg((TABLE_SIZE & (TABLE_SIZE - 1)) == 0);
+    static_assert_no_msg((sizeof(KEY) % sizeof(TADDR)) == 0);
+    static_assert_no_msg((sizeof(VALUE) % sizeof(TADDR)) == 0);
+
+    static const DWORD KEY_WORDS   = sizeof(KEY) / sizeof(TADDR);
+    static const DWORD VALUE_WORDS = sizeof(VALUE) / sizeof(TADDR);
+
+    struct Entry
+    {
+        LONG  m_version;
+        LONG  m_epoch;
+        TADDR m_key[KEY_WORDS];
+        TADDR m_value[VALUE_WORDS];
+    };
+
+    Entry m_table[TABLE_SIZE];
+    LONG  m_epoch;
+
+    Entry* GetEntry(size_t hash)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return &m_table[hash & (TABLE_SIZE - 1)];
+    }
+
+public:
+    LONG GetEpoch()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return VolatileLoad(&m_epoch);
+    }
+
+    // Makes every entry stale. Must be called after the data the cache reflects has changed.
+    void Invalidate()
+    {
+        LIMITED_METHOD_CONTRACT;
+        FastInterlockIncrement(&m_epoch);
+    }
+
+    //------------------------------------------------------------------------
+    // TryGet: Look up a key cached at the given epoch.
+    //
+    // Return Value:
+    //    TRUE and the cached value in *pValue on a hit, FALSE otherwise.
+    //
+    BOOL TryGet(size_t hash, const KEY& key, LONG epoch, VALUE* pValue)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        Entry* pEntry = GetEntry(hash);
+
+        LONG version = VolatileLoad(&pEntry->m_version);
+        if ((version & 1) != 0)
+            return FALSE;
+
+        if (VolatileLoad(&pEntry->m_epoch) != epoch)
+            return FALSE;
+
+        const TADDR* pKeyWords = (const TADDR*)&key;
+        for (DWORD i = 0; i < KEY_WORDS; i++)
+        {
+            if (VolatileLoad(&pEntry->m_key[i]) != pKeyWords[i])
+                return FALSE;
+        }
+
+        TADDR valueWords[VALUE_WORDS];
+        for (DWORD i = 0; i < VALUE_WORDS; i++)
+        {
+            valueWords[i] = VolatileLoad(&pEntry->m_value[i]);
+        }
+
+        if (VolatileLoad(&pEntry->m_version) != version)
+            return FALSE;
+
+        memcpy(pValue, valueWords, sizeof(VALUE));
+        return TRUE;
+    }
+
+    BOOL TryGet(size_t hash, const KEY& key, VALUE* pValue)
+    {
+        WRAPPER_NO_CONTRACT;
+        return TryGet(hash, key, GetEpoch(), pValue);
+    }
+
+    //------------------------------------------------------------------------
+    // TrySet: Remember the value for a key, computed at the given epoch.
+    //
+    void TrySet(size_t hash, const KEY& key, LONG epoch, const VALUE& value)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        Entry* pEntry = GetEntry(hash);
+
+        LONG version = VolatileLoad(&pEntry->m_version);
+        if ((version & 1) != 0)
+            return;
+
+        // Claim the entry; if someone else got there first just give up, it's only a cache.
+        if (FastInterlockCompareExchange(&pEntry->m_version, version + 1, version) != version)
+            return;
+
+        pEntry->m_epoch = epoch;
+        memcpy(pEntry->m_key, &key, sizeof(KEY));
+        memcpy(pEntry->m_value, &value, sizeof(VALUE));
+
+        VolatileStore(&pEntry->m_version, version + 2);
+    }
+
+    void TrySet(size_t hash, const KEY& key, const VALUE& value)
+    {
+        WRAPPER_NO_CONTRACT;
+        TrySet(hash, key, GetEpoch(), value);
+    }
+};
+
+#endif // __VERSIONEDCACHE_H__
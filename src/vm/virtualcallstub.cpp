@@ -32,6 +32,7 @@ UINT32 g_site_counter = 0;              //# of call sites
 UINT32 g_site_write = 0;                //# of call site backpatch writes
 UINT32 g_site_write_poly = 0;           //# of call site backpatch writes to point to resolve stubs
 UINT32 g_site_write_mono = 0;           //# of call site backpatch writes to point to dispatch stubs
+UINT32 g_site_write_chain = 0;          //# of call site backpatch writes to point to chained (polymorphic) dispatch stubs
 
 UINT32 g_stub_lookup_counter = 0;       //# of lookup stubs
 UINT32 g_stub_mono_counter = 0;         //# of dispatch stubs
@@ -110,6 +111,8 @@ FastTable* BucketTable::dead = NULL;    //linked list of the abandoned buckets
 
 DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line lookup by resolve stubs.
 
+UINT32 g_polyDispatchStubLimit = 0;      //max # of chained dispatch stubs per call site before it goes to the resolve stub
+
 size_t g_dispatch_cache_chain_success_counter = CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT;
 
 #ifdef STUB_LOGGING 
@@ -225,6 +228,8 @@ void VirtualCallStubManager::LoggingDump()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_mono", g_site_write_mono);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", g_site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", g_site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -897,6 +902,8 @@ void VirtualCallStubManager::InitStatic()
 
     g_resolveCache = new DispatchCache();
 
+    g_polyDispatchStubLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubPolyDispatchLimit);
+
     if(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_VirtualCallStubLogging))
         StartupLogging();
 
@@ -1515,7 +1522,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
         DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = GetResolveHolderForDispatchStub(dispatchStub);
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1632,14 +1639,23 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
         target = (PCODE) pElem->target;
 
         // Have we failed the dispatch stub too many times?
-        if (flags & SDF_ResolveBackPatch)
+        if (!(flags & SDF_ResolveBackPatch))
+        {
+            return target;
+        }
+
+        PCODE stubAddr = callSite.GetSiteTarget();
+        VirtualCallStubManager * pMgr = VirtualCallStubManager::FindStubManager(stubAddr);
+        if (!pMgr->CanExtendPolymorphicDispatch(stubAddr, pObj->GetMethodTable(), NULL))
         {
-            PCODE stubAddr = callSite.GetSiteTarget();
-            VirtualCallStubManager * pMgr = VirtualCallStubManager::FindStubManager(stubAddr);
             pMgr->BackPatchWorker(&callSite);
+            return target;
         }
 
-        return target;
+        // The call site's dispatch stub missed but its chain can take a stub for this type;
+        // take the full path so that ResolveWorker adds it.
+        token = pElem->token;
+        target = NULL;
     }
 #endif
 
@@ -1672,16 +1688,17 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
     VirtualCallStubManager *pMgr = VirtualCallStubManager::FindStubManager(callSiteTarget, &stubKind);
     PREFIX_ASSUME(pMgr != NULL);
 
+    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind);
+
 #ifndef _TARGET_X86_ 
-    // Have we failed the dispatch stub too many times?
+    // Have we failed the dispatch stub too many times? This is done after ResolveWorker, which
+    // may have chained another dispatch stub at the call site instead.
     if (flags & SDF_ResolveBackPatch)
     {
-        pMgr->BackPatchWorker(&callSite);
+        pMgr->BackPatchOrChainWorker(&callSite, callSiteTarget);
     }
 #endif
 
-    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind);
-
     GCPROTECT_END();
 
     UNINSTALL_UNWIND_AND_CONTINUE_HANDLER;
@@ -2145,6 +2162,10 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
             {
                 BackPatchSite(pCallSite, (PCODE)stub);
             }
+            else if ((stubKind == SK_DISPATCH) && bCreateDispatchStub)
+            {
+                ExtendPolymorphicDispatch(pCallSite, objectType, token, target);
+            }
         }
     }
     EX_CATCH
@@ -2650,8 +2671,8 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
         //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
-        ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
+        //(through any other dispatch stubs chained at this call site)
+        ResolveStub* resolveStub  = GetResolveHolderForDispatchStub(dispatchStub)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
 
@@ -2667,6 +2688,142 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
     }
 }
 
+//----------------------------------------------------------------------------
+/* A call site that has been backpatched to a dispatch stub and then sees a different type goes
+through the dispatch stub's failure path into ResolveWorker. Rather than leaving the call site to
+the shared resolve stub (and its global cache probe) as soon as the resolve stub's miss counter
+trips, we first give it a small polymorphic inline cache: a new dispatch stub for the new type
+whose failure target is the stub the call site currently points to. The chain is limited to
+g_polyDispatchStubLimit stubs; its last stub still fails over to the resolve stub.
+
+ResolveWorker is reached from a dispatch stub miss in two ways: when the resolve stub's global cache
+misses, and when the resolve stub's miss counter trips (SDF_ResolveBackPatch), which enters the VM
+whether or not the global cache has the type. The second path lets call sites other than the first
+one to see a <token, type> pair grow their own chain. Once the chain is full, BackPatchOrChainWorker
+switches the call site to the resolve stub as before.
+
+The chained stubs are specific to the call site, so unlike the monomorphic dispatch stubs they
+are not entered into the dispatchers table.
+*/
+void VirtualCallStubManager::ExtendPolymorphicDispatch(StubCallSite* pCallSite,
+                                                       MethodTable* objectType,
+                                                       DispatchToken token,
+                                                       PCODE target)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(CheckPointer(objectType));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END;
+
+    PCODE siteTarget = pCallSite->GetSiteTarget();
+
+    UINT32 chainLength = 0;
+    if (!CanExtendPolymorphicDispatch(siteTarget, objectType, &chainLength))
+        return;
+
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder *pDispatchHolder = GenerateDispatchStub(
+        target, siteTarget, objectType, token.To_SIZE_T(), &reenteredCooperativeGCMode);
+
+    // BackPatchSite only accepts the new stub if the call site still points to the stub it fails over to.
+    BackPatchSite(pCallSite, pDispatchHolder->stub()->entryPoint());
+
+    LOG((LF_STUBS, LL_INFO10000, "ExtendPolymorphicDispatch call-site" FMT_ADDR "chain length %d, new dispatchStub" FMT_ADDR "\n",
+         DBG_ADDR(pCallSite->GetReturnAddress()), chainLength + 1, DBG_ADDR(pDispatchHolder->stub())));
+}
+
+//----------------------------------------------------------------------------
+/* Check whether the chain of dispatch stubs starting at siteTarget can take another stub for
+objectType: it must be shorter than g_polyDispatchStubLimit and must not already have a stub for
+the type (another thread may have added it).
+*/
+BOOL VirtualCallStubManager::CanExtendPolymorphicDispatch(PCODE siteTarget,
+                                                         MethodTable* objectType,
+                                                         UINT32* pChainLength)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    if (!isDispatchingStub(siteTarget))
+        return FALSE;
+
+    UINT32 chainLength = 0;
+    for (PCODE stubEntry = siteTarget; isDispatchingStub(stubEntry); )
+    {
+        DispatchStub* dispatchStub = DispatchHolder::FromDispatchEntry(stubEntry)->stub();
+        if (dispatchStub->expectedMT() == (size_t)objectType)
+            return FALSE;
+
+        chainLength++;
+        stubEntry = dispatchStub->failTarget();
+    }
+
+    if (pChainLength != NULL)
+        *pChainLength = chainLength;
+
+    return chainLength < g_polyDispatchStubLimit;
+}
+
+//----------------------------------------------------------------------------
+/* The resolve stub's miss counter tripped while the call site pointed to the dispatch stub
+priorSiteTarget. If ResolveWorker has since chained a dispatch stub for the new type in front of it
+(see ExtendPolymorphicDispatch), keep the call site on the chain and give the counter its misses
+back. Otherwise move the call site to the resolve stub, as BackPatchWorker always did.
+*/
+void VirtualCallStubManager::BackPatchOrChainWorker(StubCallSite* pCallSite, PCODE priorSiteTarget)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    PCODE callSiteTarget = pCallSite->GetSiteTarget();
+
+    if ((callSiteTarget != priorSiteTarget) && isDispatchingStub(callSiteTarget))
+    {
+        DispatchStub* dispatchStub = DispatchHolder::FromDispatchEntry(callSiteTarget)->stub();
+        if (dispatchStub->failTarget() == priorSiteTarget)
+        {
+            INT32* counter = GetResolveHolderForDispatchStub(dispatchStub)->stub()->pCounter();
+            *counter += STUB_MISS_COUNT_VALUE;
+            return;
+        }
+    }
+
+    BackPatchWorker(pCallSite);
+}
+
+//----------------------------------------------------------------------------
+/* Dispatch stubs fail over either to a resolve stub or, for call sites with a polymorphic chain
+of dispatch stubs (see ExtendPolymorphicDispatch), to another dispatch stub. Follow the chain to
+the resolve stub at its end.
+*/
+ResolveHolder *VirtualCallStubManager::GetResolveHolderForDispatchStub(DispatchStub *dispatchStub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    PCODE failEntry = dispatchStub->failTarget();
+
+    while (isDispatchingStubStatic(failEntry))
+    {
+        failEntry = DispatchHolder::FromDispatchEntry(failEntry)->stub()->failTarget();
+    }
+
+    return ResolveHolder::FromFailEntry(failEntry);
+}
+
 //----------------------------------------------------------------------------
 /* consider changing the call site to point to stub, if appropriate do it
 */
@@ -2694,6 +2851,7 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     //  prior           new
     //  lookup          dispatching or resolving
     //  dispatching     resolving
+    //  dispatching     dispatching that fails over to prior (see ExtendPolymorphicDispatch)
     if (isResolvingStub(prior))
         return;
 
@@ -2701,7 +2859,10 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     {
         if(isDispatchingStub(prior))
         {
-            return;
+            if (DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget() != prior)
+                return;
+
+            stats.site_write_chain++;
         }
         else
         {
@@ -3141,6 +3302,8 @@ void VirtualCallStubManager::LogStats()
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_mono", stats.site_write_mono);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
+        sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_chain", stats.site_write_chain);
+        WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
         sprintf_s(szPrintStr, COUNTOF(szPrintStr), OUTPUT_FORMAT_INT, "site_write_poly", stats.site_write_poly);
         WriteFile (g_hStubLogFile, szPrintStr, (DWORD) strlen(szPrintStr), &dwWriteByte, NULL);
 
@@ -3185,6 +3348,7 @@ void VirtualCallStubManager::LogStats()
     g_site_write += stats.site_write;
     g_site_write_poly += stats.site_write_poly;
     g_site_write_mono += stats.site_write_mono;
+    g_site_write_chain += stats.site_write_chain;
     g_worker_call += stats.worker_call;
     g_worker_call_no_patch += stats.worker_call_no_patch;
     g_worker_collide_to_mono += stats.worker_collide_to_mono;
@@ -3200,6 +3364,7 @@ void VirtualCallStubManager::LogStats()
     stats.site_write = 0;
     stats.site_write_poly = 0;
     stats.site_write_mono = 0;
+    stats.site_write_chain = 0;
     stats.worker_call = 0;
     stats.worker_call_no_patch = 0;
     stats.worker_collide_to_mono = 0;
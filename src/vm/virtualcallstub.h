@@ -512,6 +512,20 @@ private:
                                        PCODE addrOfPatcher,
                                        size_t dispatchToken);
 
+    //extend the chain of dispatch stubs the call site points to with a stub for objectType
+    void ExtendPolymorphicDispatch(StubCallSite* pCallSite,
+                                   MethodTable* objectType,
+                                   DispatchToken token,
+                                   PCODE target);
+
+    //can the chain of dispatch stubs starting at siteTarget take another stub for objectType
+    BOOL CanExtendPolymorphicDispatch(PCODE siteTarget,
+                                      MethodTable* objectType,
+                                      UINT32* pChainLength);
+
+    //follow the failure path of a (possibly chained) dispatch stub to its resolve stub
+    static ResolveHolder *GetResolveHolderForDispatchStub(DispatchStub *dispatchStub);
+
     LookupHolder *GenerateLookupStub(PCODE addrOfResolver,
                                      size_t dispatchToken);
 
@@ -606,6 +620,7 @@ private:
 public:
     PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind);
     void BackPatchWorker(StubCallSite* pCallSite);
+    void BackPatchOrChainWorker(StubCallSite* pCallSite, PCODE priorSiteTarget);
 
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
@@ -809,6 +824,7 @@ public:
         UINT32 site_write;              //# of call site backpatch writes
         UINT32 site_write_poly;         //# of call site backpatch writes to point to resolve stubs
         UINT32 site_write_mono;         //# of call site backpatch writes to point to dispatch stubs
+        UINT32 site_write_chain;        //# of call site backpatch writes to point to chained (polymorphic) dispatch stubs
         UINT32 worker_call;             //# of calls into ResolveWorker
         UINT32 worker_call_no_patch;    //# of times call_worker resulted in no patch
         UINT32 worker_collide_to_mono;  //# of times we converted a poly stub to a mono stub instead of writing the cache entry
@@ -1269,6 +1285,10 @@ public:
         WRAPPER_NO_CONTRACT;
         if (stub)
         {
+            // Only monomorphic dispatch stubs are entered into the dispatchers table; they fail over
+            // directly to the resolve stub. Dispatch stubs chained at a polymorphic call site (see
+            // VirtualCallStubManager::ExtendPolymorphicDispatch) are never in the table.
+            _ASSERTE(!VirtualCallStubManager::isDispatchingStubStatic(stub->failTarget()));
             ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(stub->failTarget());
             size_t token = resolveHolder->stub()->token();
             _ASSERTE(token == VirtualCallStubManager::GetTokenFromStub((PCODE)stub));
@@ -0,0 +1,184 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+//
+
+using System;
+using System.Reflection;
+using System.Runtime.Intrinsics;
+using System.Runtime.Intrinsics.X86;
+
+// Avx512F is not in the reference assemblies the tests build against, so it is
+// called through reflection. Each call runs the recursive intrinsic method body,
+// which the JIT must expand: into the EVEX encoded instruction when the hardware
+// supports AVX512F and AVX512VL, and into a PlatformNotSupportedException throw
+// otherwise. The immediate forms take the jump table fallback for a non-constant
+// count, so every count below is a separate encoding of the instruction.
+
+namespace IntelHardwareIntrinsicTest
+{
+    class Program
+    {
+        const int Pass = 100;
+        const int Fail = 0;
+
+        static int s_testResult = Pass;
+        static Type s_avx512F;
+        static bool s_isSupported;
+
+        static long[] s_longs = { 5, -7, long.MinValue, long.MaxValue, 0, -1, 0x123456789ABCDEF0, -0x0FEDCBA987654321 };
+        static int[] s_ints = { 5, -7, int.MinValue, int.MaxValue, 0, -1, 0x12345678, -0x0FEDCBA9 };
+        static byte[] s_counts = { 0, 1, 13, 31, 32, 33, 63, 64, 200 };
+
+        static int Main(string[] args)
+        {
+            s_avx512F = typeof(Avx2).Assembly.GetType("System.Runtime.Intrinsics.X86.Avx512F");
+
+            if (s_avx512F == null)
+            {
+                Console.WriteLine("System.Runtime.Intrinsics.X86.Avx512F not found; skipping");
+                return Pass;
+            }
+
+            s_isSupported = (bool)s_avx512F.GetProperty("IsSupported").GetValue(null);
+
+            if (s_isSupported && !Avx2.IsSupported)
+            {
+                Console.WriteLine("Avx512F.IsSupported is true but Avx2.IsSupported is false");
+                s_testResult = Fail;
+            }
+
+            // 128-bit and 256-bit vectors, starting at each element of the inputs
+            for (int count = 2; count <= 4; count += 2)
+            {
+                for (int start = 0; start < s_longs.Length; start++)
+                {
+                    TestInt64(Slice(s_longs, start, count), Slice(s_longs, start + 1, count));
+                    TestInt32(Slice(s_ints, start, count * 2), Slice(s_ints, start + 3, count * 2));
+                }
+            }
+
+            return s_testResult;
+        }
+
+        static void TestInt64(long[] a, long[] b)
+        {
+            ulong[] ua = Array.ConvertAll(a, x => (ulong)x);
+            ulong[] ub = Array.ConvertAll(b, x => (ulong)x);
+
+            Test("Abs", Vector(Array.ConvertAll(a, x => (x < 0) ? unchecked((ulong)(-x)) : (ulong)x)), Vector(a));
+
+            Test("Max", Vector(Map(a, b, (x, y) => Math.Max(x, y))), Vector(a), Vector(b));
+            Test("Min", Vector(Map(a, b, (x, y) => Math.Min(x, y))), Vector(a), Vector(b));
+            Test("Max", Vector(Map(ua, ub, (x, y) => Math.Max(x, y))), Vector(ua), Vector(ub));
+            Test("Min", Vector(Map(ua, ub, (x, y) => Math.Min(x, y))), Vector(ua), Vector(ub));
+
+            foreach (byte count in s_counts)
+            {
+                Test("RotateLeft", Vector(Array.ConvertAll(ua, x => RotateLeft(x, count))), Vector(ua), count);
+                Test("RotateRight", Vector(Array.ConvertAll(ua, x => RotateLeft(x, 64 - (count % 64)))), Vector(ua), count);
+                Test("RotateLeft", Vector(Array.ConvertAll(a, x => (long)RotateLeft((ulong)x, count))), Vector(a), count);
+                Test("ShiftRightArithmetic", Vector(Array.ConvertAll(a, x => x >> Math.Min((int)count, 63))), Vector(a), count);
+            }
+
+            // Use the second input as the per-element counts, both in and out of range
+            ulong[] counts = Array.ConvertAll(b, x => (ulong)x % 80);
+
+            Test("RotateLeftVariable", Vector(Map(ua, counts, (x, c) => RotateLeft(x, (int)c))), Vector(ua), Vector(counts));
+            Test("RotateRightVariable", Vector(Map(ua, counts, (x, c) => RotateLeft(x, 64 - (int)(c % 64)))), Vector(ua), Vector(counts));
+            Test("RotateLeftVariable", Vector(Map(a, counts, (x, c) => (long)RotateLeft((ulong)x, (int)c))), Vector(a), Vector(counts));
+            Test("ShiftRightArithmeticVariable", Vector(Map(a, counts, (x, c) => x >> (int)Math.Min(c, 63))), Vector(a), Vector(counts));
+        }
+
+        static void TestInt32(int[] a, int[] b)
+        {
+            uint[] ua = Array.ConvertAll(a, x => (uint)x);
+
+            foreach (byte count in s_counts)
+            {
+                Test("RotateLeft", Vector(Array.ConvertAll(ua, x => RotateLeft(x, count))), Vector(ua), count);
+                Test("RotateRight", Vector(Array.ConvertAll(ua, x => RotateLeft(x, 32 - (count % 32)))), Vector(ua), count);
+                Test("RotateRight", Vector(Array.ConvertAll(a, x => (int)RotateLeft((uint)x, 32 - (count % 32)))), Vector(a), count);
+            }
+
+            uint[] counts = Array.ConvertAll(b, x => (uint)x % 40);
+
+            Test("RotateLeftVariable", Vector(Map(ua, counts, (x, c) => RotateLeft(x, (int)c))), Vector(ua), Vector(counts));
+            Test("RotateRightVariable", Vector(Map(a, counts, (x, c) => (int)RotateLeft((uint)x, 32 - (int)(c % 32)))), Vector(a), Vector(counts));
+        }
+
+        static void Test(string name, object expected, params object[] args)
+        {
+            Type[] types = Array.ConvertAll(args, x => x.GetType());
+            MethodInfo method = s_avx512F.GetMethod(name, types);
+
+            if (method == null)
+            {
+                Console.WriteLine("{0}({1}) not found", name, string.Join<Type>(", ", types));
+                s_testResult = Fail;
+                return;
+            }
+
+            try
+            {
+                object actual = method.Invoke(null, args);
+
+                if (!s_isSupported)
+                {
+                    Console.WriteLine("{0}({1}): expected PlatformNotSupportedException", name, string.Join(", ", args));
+                    s_testResult = Fail;
+                }
+                else if (!expected.Equals(actual))
+                {
+                    Console.WriteLine("{0}({1}): expected {2}, got {3}", name, string.Join(", ", args), expected, actual);
+                    s_testResult = Fail;
+                }
+            }
+            catch (TargetInvocationException e) when (e.InnerException is PlatformNotSupportedException)
+            {
+                if (s_isSupported)
+                {
+                    Console.WriteLine("{0}({1}): unexpected PlatformNotSupportedException", name, string.Join(", ", args));
+                    s_testResult = Fail;
+                }
+            }
+        }
+
+        static ulong RotateLeft(ulong value, int count)
+        {
+            count %= 64;
+            return (count == 0) ? value : ((value << count) | (value >> (64 - count)));
+        }
+
+        static uint RotateLeft(uint value, int count)
+        {
+            count %= 32;
+            return (count == 0) ? value : ((value << count) | (value >> (32 - count)));
+        }
+
+        static T[] Slice<T>(T[] values, int start, int count)
+        {
+            T[] result = new T[count];
+            for (int i = 0; i < count; i++)
+            {
+                result[i] = values[(start + i) % values.Length];
+            }
+            return result;
+        }
+
+        static TResult[] Map<T, U, TResult>(T[] a, U[] b, Func<T, U, TResult> op)
+        {
+            TResult[] result = new TResult[a.Length];
+            for (int i = 0; i < a.Length; i++)
+            {
+                result[i] = op(a[i], b[i]);
+            }
+            return result;
+        }
+
+        static object Vector(long[] e) => (e.Length == 2) ? (object)Vector128.Create(e[0], e[1]) : Vector256.Create(e[0], e[1], e[2], e[3]);
+        static object Vector(ulong[] e) => (e.Length == 2) ? (object)Vector128.Create(e[0], e[1]) : Vector256.Create(e[0], e[1], e[2], e[3]);
+        static object Vector(int[] e) => (e.Length == 4) ? (object)Vector128.Create(e[0], e[1], e[2], e[3]) : Vector256.Create(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7]);
+        static object Vector(uint[] e) => (e.Length == 4) ? (object)Vector128.Create(e[0], e[1], e[2], e[3]) : Vector256.Create(e[0], e[1], e[2], e[3], e[4], e[5], e[6], e[7]);
+    }
+}
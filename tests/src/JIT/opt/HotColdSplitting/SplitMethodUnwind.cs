@@ -0,0 +1,240 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Text;
+
+// Tests for methods split into hot and cold sections. The methods below have
+// no EH of their own, so the jit may split them, and their throw paths are
+// rarely run, so those go into the cold section, which the runtime allocates
+// away from the hot code. Exceptions thrown from the cold section, or thrown
+// by callees called from it, must unwind through the split method to the
+// handlers in its callers, and GCs and stack traces taken while the cold
+// section is on the stack must find the method.
+
+class SplitMethodUnwind
+{
+    static int s_returnCode = 100;
+    static string s_log;
+
+    public static int Main()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            // The hot paths, which do not throw.
+            Check("Divide", Divide(10, 3), 3);
+            Check("SumChecked", SumChecked(new[] { 1, 2, 3 }, 2), 3);
+            Check("ThrowFromCallee hot", ThrowFromCallee(null, 4), 4);
+
+            // Thrown directly from the cold section.
+            Check("Divide by zero", Throws<ArgumentException>(() => Divide(10, 0)), 1);
+            Check("SumChecked negative", Throws<ArgumentOutOfRangeException>(() => SumChecked(new[] { 1, 2, 3 }, -1)), 1);
+
+            // Thrown by a callee called from the cold section, after a GC.
+            Check("ThrowFromCallee cold", Throws<InvalidOperationException>(() => ThrowFromCallee("cold", 4)), 1);
+
+            // Finally and filter clauses in the callers run in order.
+            Check("FinallyOrder", FinallyOrder(), 1);
+            Check("FilterOrder", FilterOrder(), 1);
+
+            // The split method is on the stack trace of an exception thrown from its cold section.
+            Check("StackTrace", StackTraceHasSplitMethod(), 1);
+
+            // A GC while the cold section is on the stack keeps the live objects alive and updated.
+            Check("CollectInColdSection", CollectInColdSection(new object[] { new StringBuilder("a"), new StringBuilder("b") }), 1);
+        }
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    static int Throws<T>(Func<int> test) where T : Exception
+    {
+        try
+        {
+            test();
+            return 0;
+        }
+        catch (T)
+        {
+            return 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Divide(int a, int b)
+    {
+        if (b == 0)
+        {
+            throw new ArgumentException("b");
+        }
+        return a / b;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumChecked(int[] a, int count)
+    {
+        if (count < 0)
+        {
+            throw new ArgumentOutOfRangeException("count");
+        }
+
+        int sum = 0;
+        for (int i = 0; i < count; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ThrowFromCallee(string message, int value)
+    {
+        if (message != null)
+        {
+            // Fail always throws; the throw after it only makes this block rarely run
+            Fail(message);
+            throw new InvalidOperationException("unreachable");
+        }
+        return value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Fail(string message)
+    {
+        GC.Collect();
+        throw new InvalidOperationException(message);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void LogAndDivide(int b)
+    {
+        try
+        {
+            s_log += "t";
+            Divide(1, b);
+            s_log += "x";
+        }
+        finally
+        {
+            s_log += "f";
+        }
+    }
+
+    static int FinallyOrder()
+    {
+        s_log = "";
+        try
+        {
+            try
+            {
+                LogAndDivide(0);
+            }
+            finally
+            {
+                s_log += "F";
+            }
+        }
+        catch (ArgumentException)
+        {
+            s_log += "c";
+        }
+
+        return (s_log == "tfFc") ? 1 : 0;
+    }
+
+    static int FilterOrder()
+    {
+        s_log = "";
+        try
+        {
+            LogAndDivide(0);
+        }
+        catch (ArgumentException) when (Log("w"))
+        {
+            s_log += "c";
+        }
+
+        // The filter runs before the finally in the callee
+        return (s_log == "twfc") ? 1 : 0;
+    }
+
+    static bool Log(string s)
+    {
+        s_log += s;
+        return true;
+    }
+
+    static int StackTraceHasSplitMethod()
+    {
+        try
+        {
+            ThrowFromCallee("trace", 0);
+        }
+        catch (InvalidOperationException e)
+        {
+            StackTrace trace = new StackTrace(e, false);
+            bool sawFail = false;
+            bool sawSplit = false;
+
+            for (int i = 0; i < trace.FrameCount; i++)
+            {
+                string name = trace.GetFrame(i).GetMethod()?.Name;
+                sawFail |= (name == nameof(Fail));
+                sawSplit |= sawFail && (name == nameof(ThrowFromCallee));
+            }
+
+            return sawSplit ? 1 : 0;
+        }
+
+        return 0;
+    }
+
+    static int CollectInColdSection(object[] objects)
+    {
+        try
+        {
+            CollectAndThrow(objects, -1);
+        }
+        catch (ArgumentException e)
+        {
+            return (e.Message == "ab") ? 1 : 0;
+        }
+
+        return 0;
+    }
+
+    // The objects are used by the cold section after the call that collects
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CollectAndThrow(object[] objects, int index)
+    {
+        object first = objects[0];
+        object second = objects[1];
+
+        if (index < 0)
+        {
+            Collect(new object());
+            throw new ArgumentException(first.ToString() + second.ToString());
+        }
+
+        return objects.Length;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Collect(object o)
+    {
+        GC.Collect();
+        GC.KeepAlive(o);
+    }
+}
@@ -0,0 +1,270 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for if-conversion of conditional local stores into selects
+// (cmov on xarch, csel on arm64). Each shape is checked with both
+// outcomes of the condition.
+
+class IfConversionTests
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        CallTestAndVerify("SignedTriangle(1, 2, 7)", SignedTriangle(1, 2, 7), 7);
+        CallTestAndVerify("SignedTriangle(-1, 2, 7)", SignedTriangle(-1, 2, 7), 2);
+        CallTestAndVerify("SignedTriangle(int.MinValue, 2, 7)", SignedTriangle(int.MinValue, 2, 7), 2);
+
+        CallTestAndVerify("UnsignedTriangle(1, 2, 7)", UnsignedTriangle(1, 2, 7), 7);
+        CallTestAndVerify("UnsignedTriangle(uint.MaxValue, 2, 7)", UnsignedTriangle(uint.MaxValue, 2, 7), 2);
+        CallTestAndVerify("UnsignedTriangle(0, 2, 7)", UnsignedTriangle(0, 2, 7), 2);
+
+        CallTestAndVerify("SignedDiamond(3, 5)", SignedDiamond(3, 5), 5);
+        CallTestAndVerify("SignedDiamond(5, 3)", SignedDiamond(5, 3), 5);
+        CallTestAndVerify("SignedDiamond(-5, -3)", SignedDiamond(-5, -3), -3);
+
+        CallTestAndVerify("UnsignedDiamond(3, 5)", UnsignedDiamond(3, 5), 5);
+        CallTestAndVerify("UnsignedDiamond(uint.MaxValue, 5)", UnsignedDiamond(uint.MaxValue, 5), unchecked((int)uint.MaxValue));
+
+        CallTestAndVerify("DiamondWithComputedValues(10, 4, true)", DiamondWithComputedValues(10, 4, true), 14);
+        CallTestAndVerify("DiamondWithComputedValues(10, 4, false)", DiamondWithComputedValues(10, 4, false), 6);
+
+        // The select's target is the same local as its true or false operand.
+        CallTestAndVerify("TargetIsTrueOperand(4, 9)", TargetIsTrueOperand(4, 9), 9);
+        CallTestAndVerify("TargetIsTrueOperand(9, 4)", TargetIsTrueOperand(9, 4), 9);
+        CallTestAndVerify("TargetIsFalseOperand(4, 9)", TargetIsFalseOperand(4, 9), 4);
+        CallTestAndVerify("TargetIsFalseOperand(9, 4)", TargetIsFalseOperand(9, 4), 4);
+        CallTestAndVerify("SameValueBothArms(4, 9)", SameValueBothArms(4, 9), 13);
+
+        CallTestAndVerify("LongTriangle(0x100000000L, 3L)", LongTriangle(0x100000000L, 3L) == 0x100000000L ? 1 : 0, 1);
+        CallTestAndVerify("LongTriangle(-0x100000000L, 3L)", LongTriangle(-0x100000000L, 3L) == 3L ? 1 : 0, 1);
+        CallTestAndVerify("LongDiamond(0x100000001L, 0x200000000L)", LongDiamond(0x100000001L, 0x200000000L) == 0x200000000L ? 1 : 0, 1);
+        CallTestAndVerify("LongDiamond(0x300000000L, 0x200000000L)", LongDiamond(0x300000000L, 0x200000000L) == 0x300000000L ? 1 : 0, 1);
+        CallTestAndVerify("LongCompareIntValue(0x100000000L, 5)", LongCompareIntValue(0x100000000L, 5), 5);
+        CallTestAndVerify("LongCompareIntValue(0xFFFFFFFFL, 5)", LongCompareIntValue(0xFFFFFFFFL, 5), 0);
+
+        // GC typed locals are not converted, but must still compute the right value.
+        object a = new object();
+        object b = "b";
+        CallTestAndVerify("ReferenceTriangle(true, a, b)", ReferenceTriangle(true, a, b) == a ? 1 : 0, 1);
+        CallTestAndVerify("ReferenceTriangle(false, a, b)", ReferenceTriangle(false, a, b) == b ? 1 : 0, 1);
+        CallTestAndVerify("ReferenceDiamond(1, 2, a, b)", ReferenceDiamond(1, 2, a, b) == b ? 1 : 0, 1);
+        CallTestAndVerify("ReferenceDiamond(2, 1, a, b)", ReferenceDiamond(2, 1, a, b) == a ? 1 : 0, 1);
+        CallTestAndVerify("ReferenceKeptAlive(1, 2)", ReferenceKeptAlive(1, 2), 2);
+        CallTestAndVerify("ReferenceKeptAlive(2, 1)", ReferenceKeptAlive(2, 1), 1);
+
+        // Side effects in an arm block the conversion.
+        CallTestAndVerify("DivideInArm(10, 0, false)", DivideInArm(10, 0, false), 0);
+        CallTestAndVerify("DivideInArm(10, 2, true)", DivideInArm(10, 2, true), 5);
+
+        return s_returnCode;
+    }
+
+    static void CallTestAndVerify(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SignedTriangle(int x, int y, int z)
+    {
+        int r = y;
+        if (x > 0)
+        {
+            r = z;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int UnsignedTriangle(uint x, int y, int z)
+    {
+        int r = y;
+        if (x < 2u)
+        {
+            if (x != 0)
+            {
+                r = z;
+            }
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SignedDiamond(int x, int y)
+    {
+        int r;
+        if (x < y)
+        {
+            r = y;
+        }
+        else
+        {
+            r = x;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int UnsignedDiamond(uint x, uint y)
+    {
+        int r;
+        if (x >= y)
+        {
+            r = (int)x;
+        }
+        else
+        {
+            r = (int)y;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int DiamondWithComputedValues(int x, int y, bool add)
+    {
+        int r;
+        if (add)
+        {
+            r = x + y;
+        }
+        else
+        {
+            r = x - y;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int TargetIsTrueOperand(int x, int y)
+    {
+        if (x < y)
+        {
+            x = y;
+        }
+        return x;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int TargetIsFalseOperand(int x, int y)
+    {
+        if (y > x)
+        {
+            y = x;
+        }
+        return y;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SameValueBothArms(int x, int y)
+    {
+        int r;
+        if (x < y)
+        {
+            r = x + y;
+        }
+        else
+        {
+            r = y + x;
+        }
+        return r;
+    }
+
+    // On 32-bit targets long locals are decomposed before lowering and are
+    // left alone; on 64-bit targets they are selected like ints.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long LongTriangle(long x, long y)
+    {
+        long r = y;
+        if (x > 0)
+        {
+            r = x;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long LongDiamond(long x, long y)
+    {
+        long r;
+        if (x > y)
+        {
+            r = x;
+        }
+        else
+        {
+            r = y;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int LongCompareIntValue(long x, int y)
+    {
+        int r = 0;
+        if (x > 0xFFFFFFFFL)
+        {
+            r = y;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static object ReferenceTriangle(bool c, object x, object y)
+    {
+        object r = y;
+        if (c)
+        {
+            r = x;
+        }
+        return r;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static object ReferenceDiamond(int i, int j, object x, object y)
+    {
+        object r;
+        if (i < j)
+        {
+            r = y;
+        }
+        else
+        {
+            r = x;
+        }
+        return r;
+    }
+
+    // The selected object must stay reported to the GC across the collection.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReferenceKeptAlive(int i, int j)
+    {
+        int[] r = new int[] { 1 };
+        int[] other = new int[] { 2 };
+        if (i < j)
+        {
+            r = other;
+        }
+        GC.Collect();
+        return r[0];
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int DivideInArm(int x, int y, bool divide)
+    {
+        int r = 0;
+        if (divide)
+        {
+            r = x / y;
+        }
+        return r;
+    }
+}
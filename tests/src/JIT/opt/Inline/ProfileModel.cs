@@ -0,0 +1,134 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+// Tests that the JitInlineProfileModel coefficients drive the inlining
+// decisions of the profile inline policy. The projects that build this test
+// run it with different models, and pass the decisions the model implies as
+// the argument:
+//
+//   inline   -- a large bias, which inlines every candidate
+//   noinline -- a large negative bias, which inlines none of them
+//   loop     -- only the call site in loop term, which inlines the
+//               candidates called in a loop and no others
+//
+// The candidates are too large to always inline and grow the code when
+// inlined, so the decision is the model's. Each one records the method it
+// runs in, which is its caller when it has been inlined.
+
+class ProfileModel
+{
+    static int s_returnCode = 100;
+    static string s_ranIn;
+
+    public static int Main(string[] args)
+    {
+        string mode = (args.Length > 0) ? args[0] : "";
+        bool inlineOutsideLoop;
+        bool inlineInLoop;
+
+        switch (mode)
+        {
+            case "inline":
+                inlineOutsideLoop = true;
+                inlineInLoop = true;
+                break;
+            case "noinline":
+                inlineOutsideLoop = false;
+                inlineInLoop = false;
+                break;
+            case "loop":
+                inlineOutsideLoop = false;
+                inlineInLoop = true;
+                break;
+            default:
+                Console.WriteLine("Expected one of: inline, noinline, loop");
+                return -1;
+        }
+
+        Check("CallOnce", CallOnce(5, 9), 95, inlineOutsideLoop ? nameof(CallOnce) : nameof(Combine));
+        Check("CallInLoop", CallInLoop(5, 9), 4 * 95, inlineInLoop ? nameof(CallInLoop) : nameof(Combine));
+        Check("CallInstance", CallInstance(new Accumulator(3), 7), 31, inlineOutsideLoop ? nameof(CallInstance) : nameof(Accumulator.Add));
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, int actual, int expected, string expectedRanIn)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+
+        if (s_ranIn != expectedRanIn)
+        {
+            Console.WriteLine("FAILURE ({0}): expected the candidate to run in {1}, ran in {2}", test, expectedRanIn, s_ranIn);
+            s_returnCode = -1;
+        }
+    }
+
+    // The method that called this one, which is where an inlined candidate runs.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static string Caller()
+    {
+        return new StackFrame(1).GetMethod().Name;
+    }
+
+    static int Combine(int x, int y)
+    {
+        s_ranIn = Caller();
+
+        int a = x * 3 + y;
+        int b = (x ^ y) - 7;
+        int c = (a > b) ? a - b : b - a;
+        return (c << 2) + (a & 0xFF) - (b | 1);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallOnce(int x, int y)
+    {
+        return Combine(x, y);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallInLoop(int x, int y)
+    {
+        int sum = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            sum += Combine(x, y);
+        }
+        return sum;
+    }
+
+    class Accumulator
+    {
+        int _total;
+        int _count;
+
+        public Accumulator(int total)
+        {
+            _total = total;
+        }
+
+        public int Add(int value)
+        {
+            s_ranIn = Caller();
+
+            _total += value * 2;
+            _count++;
+            return (_count > 1) ? _total / _count : _total + value;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CallInstance(Accumulator accumulator, int value)
+    {
+        return accumulator.Add(value) + value;
+    }
+}
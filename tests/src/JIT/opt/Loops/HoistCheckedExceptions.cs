@@ -0,0 +1,191 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for hoisting loop invariant loads that may throw out of loops that
+// have side effects. Such a load can be hoisted past a side effect in the
+// loop when the same exception is already checked earlier in the loop,
+// before any side effect. It must not be hoisted when its exception is only
+// checked after a side effect: the side effect of the first iteration has
+// to happen before the exception is thrown.
+
+class Holder
+{
+    public int[] Buffer;
+    public int Length;
+}
+
+class HoistCheckedExceptions
+{
+    static int s_returnCode = 100;
+    static int s_stores;
+
+    public static int Main()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            RunTests();
+        }
+
+        return s_returnCode;
+    }
+
+    static void RunTests()
+    {
+        Holder h = new Holder { Buffer = new int[5], Length = 3 };
+
+        // Values, when nothing throws.
+        int[] dest = new int[4];
+        Check("CheckedBefore", CheckedBefore(h, dest), 4 * 5);
+        CheckArray("CheckedBefore", dest, new[] { 3, 4, 5, 6 });
+
+        dest = new int[4];
+        Check("CheckedTwiceBefore", CheckedTwiceBefore(h, dest), 4 * 3);
+        CheckArray("CheckedTwiceBefore", dest, new[] { 5, 6, 7, 8 });
+
+        s_stores = 0;
+        Check("CheckedAfter", CheckedAfter(h, 4), 4 * 3);
+        Check("CheckedAfter stores", s_stores, 4);
+
+        // The null check of h happens before the store, so nothing is stored.
+        dest = new int[4];
+        Check("CheckedBefore null", ThrowsNullReference(() => CheckedBefore(null, dest)), 1);
+        CheckArray("CheckedBefore null", dest, new[] { 0, 0, 0, 0 });
+
+        // h.Buffer is only null checked after the store to dest, which must happen first.
+        dest = new int[4];
+        Holder noBuffer = new Holder { Buffer = null, Length = 3 };
+        Check("CheckedBefore null buffer", ThrowsNullReference(() => CheckedBefore(noBuffer, dest)), 1);
+        CheckArray("CheckedBefore null buffer", dest, new[] { 3, 0, 0, 0 });
+
+        // Both checks happen before the store.
+        dest = new int[4];
+        Check("CheckedTwiceBefore null buffer", ThrowsNullReference(() => CheckedTwiceBefore(noBuffer, dest)), 1);
+        CheckArray("CheckedTwiceBefore null buffer", dest, new[] { 0, 0, 0, 0 });
+
+        // The only null check of h is after the store to a static.
+        s_stores = 0;
+        Check("CheckedAfter null", ThrowsNullReference(() => CheckedAfter(null, 4)), 1);
+        Check("CheckedAfter null stores", s_stores, 1);
+
+        // The bounds check of a[0] is before the store, the length of a is loaded after it.
+        dest = new int[4];
+        Check("LengthCheckedBefore", LengthCheckedBefore(new int[] { 2, 7 }, dest), 4 * 2);
+        CheckArray("LengthCheckedBefore", dest, new[] { 2, 2, 2, 2 });
+
+        dest = new int[4];
+        Check("LengthCheckedBefore empty", ThrowsIndexOutOfRange(() => LengthCheckedBefore(new int[0], dest)), 1);
+        CheckArray("LengthCheckedBefore empty", dest, new[] { 0, 0, 0, 0 });
+
+        dest = new int[4];
+        Check("LengthCheckedBefore null", ThrowsNullReference(() => LengthCheckedBefore(null, dest)), 1);
+        CheckArray("LengthCheckedBefore null", dest, new[] { 0, 0, 0, 0 });
+    }
+
+    static void Check(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    static void CheckArray(string test, int[] actual, int[] expected)
+    {
+        for (int i = 0; i < actual.Length; i++)
+        {
+            if (actual[i] != expected[i])
+            {
+                Console.WriteLine("FAILURE ({0}): expected {1} at index {2}, got {3}", test, expected[i], i, actual[i]);
+                s_returnCode = -1;
+                return;
+            }
+        }
+    }
+
+    static int ThrowsNullReference(Func<int> test)
+    {
+        try
+        {
+            test();
+            return 0;
+        }
+        catch (NullReferenceException)
+        {
+            return 1;
+        }
+    }
+
+    static int ThrowsIndexOutOfRange(Func<int> test)
+    {
+        try
+        {
+            test();
+            return 0;
+        }
+        catch (IndexOutOfRangeException)
+        {
+            return 1;
+        }
+    }
+
+    // h is null checked by the load of h.Length before the store, so the
+    // load of h.Buffer after the store may be hoisted. The load of its
+    // length null checks h.Buffer, which is not checked before the store.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CheckedBefore(Holder h, int[] dest)
+    {
+        int total = 0;
+        for (int i = 0; i < dest.Length; i++)
+        {
+            int length = h.Length;
+            dest[i] = length + i;
+            total += h.Buffer.Length;
+        }
+        return total;
+    }
+
+    // Both h and h.Buffer are null checked before the store.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CheckedTwiceBefore(Holder h, int[] dest)
+    {
+        int total = 0;
+        for (int i = 0; i < dest.Length; i++)
+        {
+            int bufferLength = h.Buffer.Length;
+            dest[i] = bufferLength + i;
+            total += h.Length;
+        }
+        return total;
+    }
+
+    // h is only null checked after the store, so the load of h.Length
+    // must stay after it.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CheckedAfter(Holder h, int count)
+    {
+        int total = 0;
+        for (int i = 0; i < count; i++)
+        {
+            s_stores++;
+            total += h.Length;
+        }
+        return total;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int LengthCheckedBefore(int[] a, int[] dest)
+    {
+        int total = 0;
+        for (int i = 0; i < dest.Length; i++)
+        {
+            dest[i] = a[0];
+            total += a.Length;
+        }
+        return total;
+    }
+}
@@ -0,0 +1,273 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for loop cloning of loops with non-unit strides and inclusive ("<=")
+// limits. Each loop is run both with arguments that pass the cloning
+// conditions (the fast copy without bounds checks) and with arguments that
+// fail them (the slow copy, which must still throw at the right iteration).
+
+class LoopCloningStrides
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        // Strides that step over the end of the array: the iterator goes past
+        // Length without ever indexing there.
+        for (int length = 0; length <= 20; length++)
+        {
+            int[] a = MakeArray(length);
+            Check("SumStride3 " + length, SumStride3(a), SumExpected(0, length, 3));
+            Check("SumStride16 " + length, SumStride16(a), SumExpected(0, length, 16));
+            Check("SumStride17 " + length, SumStride17(a), SumExpected(0, length, 17));
+            Check("SumStride4From " + length, SumStride4From(a, 2, length), SumExpected(2, length, 4));
+        }
+
+        // A variable limit below the length passes the cloning conditions.
+        Check("SumStride4From below length", SumStride4From(MakeArray(30), 1, 20), SumExpected(1, 20, 4));
+
+        // A limit past the length fails them: the slow copy stores every
+        // element up to the end and then throws on the first index past it.
+        CheckStoreStride3("limit past length", 10, 0, 13, new[] { 1, 0, 0, 4, 0, 0, 7, 0, 0, 10 });
+        CheckStoreStride3("limit one past length", 9, 0, 10, new[] { 1, 0, 0, 4, 0, 0, 7, 0, 0 });
+        CheckStoreStride3("limit at length", 9, 0, 9, null);
+
+        // So does a negative start, which throws before storing anything.
+        CheckStoreStride3("negative start", 4, -2, 4, new[] { 0, 0, 0, 0 });
+
+        // Inclusive limits: Length - 1 is the last valid index and passes the
+        // cloning conditions. Length does not, and must throw only after
+        // every element has been stored.
+        for (int length = 0; length <= 8; length++)
+        {
+            CheckStoreInclusive("Length - 1, length " + length, length, length - 1, null);
+            CheckStoreInclusive("Length, length " + length, length, length, Iota(length));
+
+            if (length > 0)
+            {
+                Check("SumInclusive " + length, SumInclusive(MakeArray(length), length - 1), SumExpected(0, length, 1));
+            }
+        }
+
+        // Inclusive limits with a stride; the last index reached may or may
+        // not be the limit itself.
+        Check("SumInclusiveStride2 9", SumInclusiveStride2(MakeArray(10), 9), SumExpected(0, 10, 2));
+        Check("SumInclusiveStride2 8", SumInclusiveStride2(MakeArray(10), 8), SumExpected(0, 9, 2));
+        Check("SumInclusiveStride3 10", SumInclusiveStride3(MakeArray(11), 10), SumExpected(0, 11, 3));
+        Check("SumInclusiveStride3 10 short", ThrowsIndexOutOfRange(() => SumInclusiveStride3(MakeArray(10), 10)), 0);
+        Check("SumInclusiveStride3 11 short", ThrowsIndexOutOfRange(() => SumInclusiveStride3(MakeArray(10), 11)), 0);
+        Check("SumInclusiveStride2 10 short", ThrowsIndexOutOfRange(() => SumInclusiveStride2(MakeArray(10), 10)), 1);
+
+        // A null array fails the cloning conditions too.
+        bool threw = false;
+        try
+        {
+            SumStride3(null);
+        }
+        catch (NullReferenceException)
+        {
+            threw = true;
+        }
+        Check("SumStride3 null", threw ? 1 : 0, 1);
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    static void CheckArray(string test, int[] actual, int[] expected)
+    {
+        for (int i = 0; i < actual.Length; i++)
+        {
+            if (actual[i] != expected[i])
+            {
+                Console.WriteLine("FAILURE ({0}): expected {1} at index {2}, got {3}", test, expected[i], i, actual[i]);
+                s_returnCode = -1;
+                return;
+            }
+        }
+    }
+
+    static int ThrowsIndexOutOfRange(Func<int> test)
+    {
+        try
+        {
+            test();
+            return 0;
+        }
+        catch (IndexOutOfRangeException)
+        {
+            return 1;
+        }
+    }
+
+    // Runs StoreStride3 and checks both whether it threw and what it stored
+    // before that. A null expectedContents means it is expected not to throw.
+    static void CheckStoreStride3(string test, int length, int start, int limit, int[] expectedContents)
+    {
+        int[] a = new int[length];
+        int threw = ThrowsIndexOutOfRange(() => { StoreStride3(a, start, limit); return 0; });
+
+        Check("StoreStride3 " + test, threw, (expectedContents != null) ? 1 : 0);
+
+        if (expectedContents != null)
+        {
+            CheckArray("StoreStride3 " + test, a, expectedContents);
+        }
+    }
+
+    static void CheckStoreInclusive(string test, int length, int limit, int[] expectedContents)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < length; i++)
+        {
+            a[i] = -1;
+        }
+
+        int threw = ThrowsIndexOutOfRange(() => { StoreInclusive(a, limit); return 0; });
+
+        Check("StoreInclusive " + test, threw, (expectedContents != null) ? 1 : 0);
+        CheckArray("StoreInclusive " + test, a, Iota(length));
+    }
+
+    static int[] MakeArray(int length)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < length; i++)
+        {
+            a[i] = i + 1;
+        }
+        return a;
+    }
+
+    static int[] Iota(int length)
+    {
+        int[] a = new int[length];
+        for (int i = 0; i < length; i++)
+        {
+            a[i] = i;
+        }
+        return a;
+    }
+
+    // The sum of MakeArray's elements at start, start + stride, ... below limit.
+    static int SumExpected(int start, int limit, int stride)
+    {
+        int sum = 0;
+        for (int i = start; i < limit; i++)
+        {
+            if (((i - start) % stride) == 0)
+            {
+                sum += i + 1;
+            }
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStride3(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i += 3)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStride16(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i += 16)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    // Beyond the largest stride that is cloned; must still compute the same result.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStride17(int[] a)
+    {
+        int sum = 0;
+        for (int i = 0; i < a.Length; i += 17)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStride4From(int[] a, int start, int limit)
+    {
+        int sum = 0;
+        for (int i = start; i < limit; i += 4)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void StoreStride3(int[] a, int start, int limit)
+    {
+        for (int i = start; i < limit; i += 3)
+        {
+            a[i] = i + 1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void StoreInclusive(int[] a, int limit)
+    {
+        for (int i = 0; i <= limit; i++)
+        {
+            a[i] = i;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumInclusive(int[] a, int limit)
+    {
+        int sum = 0;
+        for (int i = 0; i <= limit; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumInclusiveStride2(int[] a, int limit)
+    {
+        int sum = 0;
+        for (int i = 0; i <= limit; i += 2)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumInclusiveStride3(int[] a, int limit)
+    {
+        int sum = 0;
+        for (int i = 0; i <= limit; i += 3)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+}
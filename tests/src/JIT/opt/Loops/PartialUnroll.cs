@@ -0,0 +1,189 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for partial unrolling of small single-block loops whose trip count
+// is only known at run time. The unrolled copies each keep an exit test, so
+// every trip count must leave the loop after exactly the right iteration.
+
+class PartialUnroll
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        int[] data = new int[33];
+        for (int i = 0; i < data.Length; i++)
+        {
+            data[i] = i + 1;
+        }
+
+        // Even and odd trip counts, including a single trip.
+        for (int n = 1; n <= data.Length; n++)
+        {
+            Check("SumPrefix(" + n + ")", SumPrefix(data, n), n * (n + 1) / 2);
+            Check("CountUp(" + n + ")", CountUp(n), n);
+        }
+
+        // The loop body runs once even when the limit is already reached.
+        Check("CountUp(0)", CountUp(0), 1);
+        Check("CountUp(-5)", CountUp(-5), 1);
+
+        // Non-unit steps, so the trip count isn't limit - start.
+        Check("SumStep(0, 10, 3)", SumStep(0, 10, 3), 0 + 3 + 6 + 9);
+        Check("SumStep(0, 12, 3)", SumStep(0, 12, 3), 0 + 3 + 6 + 9);
+        Check("SumStep(1, 12, 3)", SumStep(1, 12, 3), 1 + 4 + 7 + 10);
+        Check("SumStep(5, 6, 7)", SumStep(5, 6, 7), 5);
+
+        // The iterator is visible after the loop.
+        Check("LastIndex(7)", LastIndex(7), 7);
+        Check("LastIndex(8)", LastIndex(8), 8);
+        Check("LastIndex(1)", LastIndex(1), 1);
+
+        // An inner loop nested in an outer loop, with inner trip counts that
+        // change parity from one outer iteration to the next.
+        for (int rows = 1; rows <= 6; rows++)
+        {
+            Check("Triangle(" + rows + ")", Triangle(rows), TriangleExpected(rows));
+        }
+
+        Check("Matrix(3, 5)", SumMatrix(MakeMatrix(3, 5)), SumMatrixExpected(3, 5));
+        Check("Matrix(4, 4)", SumMatrix(MakeMatrix(4, 4)), SumMatrixExpected(4, 4));
+        Check("Matrix(1, 1)", SumMatrix(MakeMatrix(1, 1)), SumMatrixExpected(1, 1));
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumPrefix(int[] a, int n)
+    {
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CountUp(int n)
+    {
+        int count = 0;
+        int i = 0;
+        do
+        {
+            count++;
+            i++;
+        } while (i < n);
+        return count;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumStep(int start, int limit, int step)
+    {
+        int sum = 0;
+        int i = start;
+        do
+        {
+            sum += i;
+            i += step;
+        } while (i < limit);
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int LastIndex(int n)
+    {
+        int i = 0;
+        int x = 0;
+        do
+        {
+            x ^= i;
+            i++;
+        } while (i < n);
+        return (x == Xor(n)) ? i : -1;
+    }
+
+    static int Xor(int n)
+    {
+        int x = 0;
+        for (int i = 0; i < n; i++)
+        {
+            x ^= i;
+        }
+        return x;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Triangle(int rows)
+    {
+        int sum = 0;
+        for (int r = 1; r <= rows; r++)
+        {
+            int j = 0;
+            do
+            {
+                sum += r;
+                j++;
+            } while (j < r);
+        }
+        return sum;
+    }
+
+    static int TriangleExpected(int rows)
+    {
+        int sum = 0;
+        for (int r = 1; r <= rows; r++)
+        {
+            sum += r * r;
+        }
+        return sum;
+    }
+
+    static int[][] MakeMatrix(int rows, int columns)
+    {
+        int[][] m = new int[rows][];
+        for (int r = 0; r < rows; r++)
+        {
+            m[r] = new int[columns];
+            for (int c = 0; c < columns; c++)
+            {
+                m[r][c] = r * columns + c;
+            }
+        }
+        return m;
+    }
+
+    static int SumMatrixExpected(int rows, int columns)
+    {
+        int n = rows * columns;
+        return n * (n - 1) / 2;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int SumMatrix(int[][] m)
+    {
+        int sum = 0;
+        for (int r = 0; r < m.Length; r++)
+        {
+            int[] row = m[r];
+            for (int c = 0; c < row.Length; c++)
+            {
+                sum += row[c];
+            }
+        }
+        return sum;
+    }
+}
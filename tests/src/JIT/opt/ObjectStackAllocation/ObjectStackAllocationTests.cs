@@ -132,6 +132,8 @@ namespace ObjectStackAllocation
 
             CallTestAndVerifyAllocation(TestMixOfReportingAndWriteBarriers, 34, expectedAllocationKind);
 
+            CallTestAndVerifyAllocation(AllocateSimpleClassInLoopAndAddFields, 26, expectedAllocationKind);
+
             // The object is currently allocated on the stack when this method is jitted and on the heap when it's R2R-compiled.
             // The reason is that we always do the type check via helper in R2R mode, which blocks stack allocation.
             // We don't have to use a helper in this case (even for R2R), https://github.com/dotnet/coreclr/issues/22086 tracks fixing that.
@@ -151,6 +153,9 @@ namespace ObjectStackAllocation
             // Stack allocation of boxed structs is currently disabled
             CallTestAndVerifyAllocation(BoxSimpleStructAndAddFields, 12, expectedAllocationKind);
 
+            // The object allocated in one iteration is still referenced in the next one
+            CallTestAndVerifyAllocation(AllocateSimpleClassInLoopAndKeepPrevious, 70, expectedAllocationKind);
+
             return methodResult;
         }
 
@@ -326,5 +331,37 @@ namespace ObjectStackAllocation
 
             return c1.o.ToString().Length + c2.o.ToString().Length + c3.o.ToString().Length + c4.o.ToString().Length;
         }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int AllocateSimpleClassInLoopAndAddFields()
+        {
+            int sum = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                SimpleClassA a = new SimpleClassA(i, f1);
+                sum += a.f1 + a.f2;
+            }
+            GC.Collect();
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int AllocateSimpleClassInLoopAndKeepPrevious()
+        {
+            SimpleClassA prev = null;
+            int sum = 0;
+            for (int i = 1; i <= 4; i++)
+            {
+                SimpleClassA a = new SimpleClassA(i, i);
+                if (prev != null)
+                {
+                    sum += prev.f1 * 10;
+                }
+                sum += a.f2;
+                prev = a;
+            }
+            GC.Collect();
+            return sum;
+        }
     }
 }
@@ -0,0 +1,216 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for redundant branch elimination: a conditional branch may only be
+// folded when a dominating branch on the same (or reversed) condition fully
+// decides its outcome.
+
+class RedundantBranchTests
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        CallTestAndVerify("ImpliedTrue(5, 3)", ImpliedTrue(5, 3), 1);
+        CallTestAndVerify("ImpliedTrue(3, 5)", ImpliedTrue(3, 5), 3);
+
+        CallTestAndVerify("ImpliedFalse(5, 3)", ImpliedFalse(5, 3), 3);
+        CallTestAndVerify("ImpliedFalse(3, 5)", ImpliedFalse(3, 5), 2);
+
+        CallTestAndVerify("ImpliedFalseReversed(5, 3)", ImpliedFalseReversed(5, 3), 3);
+        CallTestAndVerify("ImpliedFalseReversed(3, 5)", ImpliedFalseReversed(3, 5), 1);
+
+        CallTestAndVerify("ImpliedUnsigned(5, 3)", ImpliedUnsigned(5, 3), 1);
+        CallTestAndVerify("ImpliedUnsigned(uint.MaxValue, 3)", ImpliedUnsigned(uint.MaxValue, 3), 1);
+        CallTestAndVerify("ImpliedUnsigned(3, 5)", ImpliedUnsigned(3, 5), 3);
+
+        CallTestAndVerify("ReachedFromBothOutcomes(5, 3, false)", ReachedFromBothOutcomes(5, 3, false), 1);
+        CallTestAndVerify("ReachedFromBothOutcomes(3, 5, false)", ReachedFromBothOutcomes(3, 5, false), 3);
+        CallTestAndVerify("ReachedFromBothOutcomes(3, 5, true)", ReachedFromBothOutcomes(3, 5, true), 2);
+
+        CallTestAndVerify("ReachedThroughLoop(4, 1)", ReachedThroughLoop(4, 1), 11);
+        CallTestAndVerify("ReachedThroughLoop(1, 4)", ReachedThroughLoop(1, 4), 4);
+
+        CallTestAndVerify("ReachedThroughHandler(10, 20, new int[1])", ReachedThroughHandler(10, 20, new int[1]), 1);
+        CallTestAndVerify("ReachedThroughHandler(0, 20, new int[1])", ReachedThroughHandler(0, 20, new int[1]), 5);
+        CallTestAndVerify("ReachedThroughHandler(30, 20, new int[1])", ReachedThroughHandler(30, 20, new int[1]), 2);
+
+        CallTestAndVerify("NaNCompare(1.0, 2.0)", NaNCompare(1.0, 2.0), 2);
+        CallTestAndVerify("NaNCompare(double.NaN, 2.0)", NaNCompare(double.NaN, 2.0), 4);
+
+        return s_returnCode;
+    }
+
+    static void CallTestAndVerify(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    // The inner test is only reached when the outer one was true.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ImpliedTrue(int a, int b)
+    {
+        if (a > b)
+        {
+            if (a > b)
+            {
+                return 1;
+            }
+
+            return 2;
+        }
+
+        return 3;
+    }
+
+    // The inner test is only reached when the outer one was false.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ImpliedFalse(int a, int b)
+    {
+        if (a > b)
+        {
+            return 3;
+        }
+
+        if (a > b)
+        {
+            return 1;
+        }
+
+        return 2;
+    }
+
+    // The inner test is the reverse of the outer one.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ImpliedFalseReversed(int a, int b)
+    {
+        if (a > b)
+        {
+            return 3;
+        }
+
+        if (a <= b)
+        {
+            return 1;
+        }
+
+        return 2;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ImpliedUnsigned(uint a, uint b)
+    {
+        if (a > b)
+        {
+            if (b < a)
+            {
+                return 1;
+            }
+
+            return 2;
+        }
+
+        return 3;
+    }
+
+    // The false side of the first test can also reach the second one, so the
+    // second test must not be folded even though that path is rarely taken.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReachedFromBothOutcomes(int a, int b, bool rare)
+    {
+        if (a > b)
+        {
+            goto Check;
+        }
+
+        if (rare)
+        {
+            goto Check;
+        }
+
+        return 3;
+
+    Check:
+        if (a > b)
+        {
+            return 1;
+        }
+
+        return 2;
+    }
+
+    // The second test is reached again through the loop back edge, after the
+    // condition has changed.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReachedThroughLoop(int a, int b)
+    {
+        int result = 0;
+
+        while (true)
+        {
+            if (a > b)
+            {
+                result += 10;
+                a = b;
+                continue;
+            }
+
+            if (a > b)
+            {
+                return -1;
+            }
+
+            return result + b;
+        }
+    }
+
+    // The last test is reached through the catch handler from the side of the
+    // first test that never falls through to it, so it can't be folded.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReachedThroughHandler(int a, int b, int[] arr)
+    {
+        if (a <= b)
+        {
+            try
+            {
+                arr[a] = b;
+                return 5;
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+        }
+
+        if (a <= b)
+        {
+            return 1;
+        }
+
+        return 2;
+    }
+
+    // Floating point relops other than EQ/NE can't be reversed.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int NaNCompare(double a, double b)
+    {
+        if (a < b)
+        {
+            return 2;
+        }
+
+        if (a >= b)
+        {
+            return 3;
+        }
+
+        return 4;
+    }
+}
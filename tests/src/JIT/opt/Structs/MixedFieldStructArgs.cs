@@ -0,0 +1,247 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for passing promoted two field structs with floating point fields to
+// calls that are not inlined. On SysV AMD64 each eightbyte of such a struct is
+// passed in a register of its own class, so a field that fills an SSE
+// eightbyte can be passed from its own register, while fields that share an
+// eightbyte with padding of another class must still be passed correctly. The
+// structs are modified field by field before each call so they stay promoted,
+// and the callees take enough arguments to run out of argument registers.
+
+struct DoubleDouble
+{
+    public double A;
+    public double B;
+}
+
+struct LongDouble
+{
+    public long A;
+    public double B;
+}
+
+struct DoubleLong
+{
+    public double A;
+    public long B;
+}
+
+struct FloatDouble
+{
+    public float A;
+    public double B;
+}
+
+struct DoubleFloat
+{
+    public double A;
+    public float B;
+}
+
+struct IntFloat
+{
+    public int A;
+    public float B;
+}
+
+struct ObjectDouble
+{
+    public object A;
+    public double B;
+}
+
+class MixedFieldStructArgs
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            Check("DoubleDouble", PassDoubleDouble(i), 3.5 + i);
+            Check("LongDouble", PassLongDouble(i), 7.25 + i);
+            Check("DoubleLong", PassDoubleLong(i), -1.75 - 2 * i);
+            Check("FloatDouble", PassFloatDouble(i), 0.5 + 3 * i);
+            Check("DoubleFloat", PassDoubleFloat(i), 10.0 - i);
+            Check("IntFloat", PassIntFloat(i), 6.5 + i);
+            Check("ObjectDouble", PassObjectDouble(i), 4.0 + i);
+            Check("Mixed", PassMixed(i), 31.5 + 4 * i);
+            Check("ManyArgs", PassMany(i), 18 + 12 * i);
+        }
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, double actual, double expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassDoubleDouble(int i)
+    {
+        DoubleDouble s;
+        s.A = 1.25;
+        s.B = 2.25 + i;
+        return TakeDoubleDouble(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeDoubleDouble(DoubleDouble s) => s.A + s.B;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassLongDouble(int i)
+    {
+        LongDouble s;
+        s.A = 5 + i;
+        s.B = 2.25;
+        return TakeLongDouble(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeLongDouble(LongDouble s) => s.A + s.B;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassDoubleLong(int i)
+    {
+        DoubleLong s;
+        s.A = 0.25 - i;
+        s.B = -2 - i;
+        return TakeDoubleLong(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeDoubleLong(DoubleLong s) => s.A + s.B;
+
+    // The float shares its eightbyte with padding.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassFloatDouble(int i)
+    {
+        FloatDouble s;
+        s.A = 0.5f + i;
+        s.B = 2 * i;
+        return TakeFloatDouble(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeFloatDouble(FloatDouble s) => s.A + s.B;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassDoubleFloat(int i)
+    {
+        DoubleFloat s;
+        s.A = 9.5;
+        s.B = 0.5f - i;
+        return TakeDoubleFloat(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeDoubleFloat(DoubleFloat s) => s.A + s.B;
+
+    // Both fields share a single eightbyte, which is classified as integer.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassIntFloat(int i)
+    {
+        IntFloat s;
+        s.A = 4 + i;
+        s.B = 2.5f;
+        return TakeIntFloat(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeIntFloat(IntFloat s) => s.A + s.B;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassObjectDouble(int i)
+    {
+        ObjectDouble s;
+        s.A = "four";
+        s.B = i;
+        return TakeObjectDouble(s);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeObjectDouble(ObjectDouble s)
+    {
+        GC.Collect();
+        return ((string)s.A).Length + s.B;
+    }
+
+    // Structs of different classifications in one call, with the same struct passed twice.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassMixed(int i)
+    {
+        DoubleDouble dd;
+        dd.A = 1.5;
+        dd.B = 2.5 + i;
+
+        LongDouble ld;
+        ld.A = 3 + i;
+        ld.B = 4.5;
+
+        DoubleLong dl;
+        dl.A = 5.5 + i;
+        dl.B = 6;
+
+        FloatDouble fd;
+        fd.A = 7.5f;
+        fd.B = i;
+
+        return TakeMixed(dd, ld, 1 + i, dl, fd, dd) - i;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeMixed(DoubleDouble dd1, LongDouble ld, int x, DoubleLong dl, FloatDouble fd, DoubleDouble dd2)
+    {
+        return dd1.A + dd1.B + ld.A + ld.B + x + dl.A + dl.B + fd.A + fd.B + (dd2.A - dd1.A) + (dd2.B - dd1.B);
+    }
+
+    // More floating point eightbytes than there are argument registers, so some structs go on the stack.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double PassMany(int i)
+    {
+        DoubleDouble a;
+        a.A = 0.5;
+        a.B = 1 + i;
+
+        DoubleDouble b;
+        b.A = 1 + i;
+        b.B = 0.5;
+
+        LongDouble c;
+        c.A = 1;
+        c.B = 0.5 + i;
+
+        DoubleLong d;
+        d.A = 0.5 + i;
+        d.B = 1;
+
+        return TakeMany(a, b, c, d, a, b, c, d, a, b, c, d);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static double TakeMany(DoubleDouble a1, DoubleDouble b1, LongDouble c1, DoubleLong d1,
+                           DoubleDouble a2, DoubleDouble b2, LongDouble c2, DoubleLong d2,
+                           DoubleDouble a3, DoubleDouble b3, LongDouble c3, DoubleLong d3)
+    {
+        double sum1 = a1.A + a1.B + b1.A + b1.B + c1.A + c1.B + d1.A + d1.B;
+        double sum2 = a2.A + a2.B + b2.A + b2.B + c2.A + c2.B + d2.A + d2.B;
+        double sum3 = a3.A + a3.B + b3.A + b3.B + c3.A + c3.B + d3.A + d3.B;
+
+        if ((sum1 != sum2) || (sum2 != sum3))
+        {
+            return -1;
+        }
+
+        return sum1 + sum2 + sum3;
+    }
+}
@@ -0,0 +1,179 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Tests for promotion of struct fields that are nested single field wrappers
+// (a struct wrapping a struct wrapping a scalar). Such a field is promoted as
+// the wrapped scalar, and every access through the wrapper chain must read
+// and write that promoted field: whole wrapper copies, accesses of the
+// intermediate wrappers and of the innermost scalar.
+
+struct Id
+{
+    public int Value;
+}
+
+struct UserId
+{
+    public Id Id;
+}
+
+struct TenantUserId
+{
+    public UserId UserId;
+}
+
+struct Ticks
+{
+    public long Value;
+}
+
+struct Timestamp
+{
+    public Ticks Ticks;
+}
+
+struct Ratio
+{
+    public double Value;
+}
+
+struct Scaled
+{
+    public Ratio Ratio;
+}
+
+struct Record
+{
+    public UserId Owner;
+    public TenantUserId Tenant;
+    public Timestamp Created;
+    public Scaled Scale;
+    public int Flags;
+}
+
+class NestedWrapperPromotion
+{
+    static int s_returnCode = 100;
+
+    public static int Main()
+    {
+        Check("ReadInner", ReadInner(3, 4), 3 * 1000 + 4);
+        Check("WriteInner", WriteInner(5, 6), 5 * 1000 + 6 + 1);
+        Check("CopyWrappers", CopyWrappers(7, 8), 8 * 1000 + 7);
+        Check("PassWrappers", PassWrappers(9, 10), 9 * 1000 + 10);
+        Check("ReturnWrapper", ReturnWrapper(11), 11 + 12);
+        Check("LongAndDouble", LongAndDouble(1L << 40, 2.5), (int)((1L << 40) >> 32) + 5);
+        Check("Loop", Loop(100), 100 * 99 / 2 * 3);
+
+        return s_returnCode;
+    }
+
+    static void Check(string test, int actual, int expected)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine("FAILURE ({0}): expected {1}, got {2}", test, expected, actual);
+            s_returnCode = -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReadInner(int owner, int tenant)
+    {
+        Record r = default;
+        r.Owner.Id.Value = owner;
+        r.Tenant.UserId.Id.Value = tenant;
+        r.Flags = 1000;
+        return r.Owner.Id.Value * r.Flags + r.Tenant.UserId.Id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int WriteInner(int owner, int tenant)
+    {
+        Record r = default;
+        r.Owner.Id.Value = owner;
+        r.Tenant.UserId.Id.Value = tenant;
+        r.Tenant.UserId.Id.Value++;
+        r.Flags = 1000;
+        return r.Owner.Id.Value * r.Flags + r.Tenant.UserId.Id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CopyWrappers(int a, int b)
+    {
+        Record r = default;
+        r.Owner.Id.Value = a;
+        r.Tenant.UserId.Id.Value = b;
+
+        // Swap through the intermediate wrappers.
+        Id id = r.Owner.Id;
+        r.Owner.Id = r.Tenant.UserId.Id;
+        r.Tenant.UserId = new UserId { Id = id };
+
+        return r.Owner.Id.Value * 1000 + r.Tenant.UserId.Id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int PassWrappers(int owner, int tenant)
+    {
+        Record r = default;
+        r.Owner.Id.Value = owner;
+        r.Tenant.UserId.Id.Value = tenant;
+        return Combine(r.Owner, r.Tenant.UserId.Id, r.Tenant);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Combine(UserId owner, Id id, TenantUserId tenant)
+    {
+        if (id.Value != tenant.UserId.Id.Value)
+        {
+            return -1;
+        }
+
+        return owner.Id.Value * 1000 + id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static UserId MakeUserId(int value)
+    {
+        return new UserId { Id = new Id { Value = value } };
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ReturnWrapper(int value)
+    {
+        Record r = default;
+        r.Owner = MakeUserId(value);
+        r.Tenant.UserId = MakeUserId(value + 1);
+        return r.Owner.Id.Value + r.Tenant.UserId.Id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int LongAndDouble(long ticks, double ratio)
+    {
+        Record r = default;
+        r.Created.Ticks.Value = ticks;
+        r.Scale.Ratio.Value = ratio;
+
+        Timestamp t = r.Created;
+        Ratio s = r.Scale.Ratio;
+
+        return (int)(t.Ticks.Value >> 32) + (int)(s.Value * 2);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Loop(int n)
+    {
+        Record r = default;
+        for (int i = 0; i < n; i++)
+        {
+            r.Owner.Id.Value += i;
+            r.Tenant.UserId.Id.Value += 2 * i;
+        }
+        return r.Owner.Id.Value + r.Tenant.UserId.Id.Value;
+    }
+}